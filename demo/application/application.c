@@ -1,12 +1,18 @@
 
 #include "application.h"
 
-struct application_resources application_resources;
-
 void application_run()
 {
 	console_printf(&application_resources.console, "hello world!");
 
+	// a console is a writer too, so it can be passed to code using writers only
+	writer output = console_as_writer(&application_resources.console);
+	writer_write(&output, "\n", 1);
+
+	// the methods of the base are bound like the own ones, the delegate is the one of writer
+	writer_write_delegate write_output = console_write_bind(&application_resources.console);
+	writer_write_delegate_call(write_output, "\n", 1);
+
 	bool value = gpio_pin_get_value(&application_resources.input_pin);
 	gpio_pin_set_value(&application_resources.output_pin, !value);
 }
\ No newline at end of file
@@ -13,6 +13,7 @@ struct application_resources{
 
 };
 
+// defined by the one who wires the objects (demo.c)
 extern struct application_resources application_resources;
 
 void application_run();
@@ -0,0 +1,122 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "byte_ring.h"
+
+static bool initialize_impl(byte_ring_impl * self, void * memory, size_t block_size, size_t block_count)
+{
+	if(!memory || !block_size || !block_count){
+		return false;
+	}
+	
+	self->memory = memory;
+	self->block_size = block_size;
+	self->block_count = block_count;
+	atomic_init(&self->closed, false);
+	
+	atomic_init(&self->producer.position, 0);
+	self->producer.other_position = 0;
+	self->producer.offset = 0;
+	
+	atomic_init(&self->consumer.position, 0);
+	self->consumer.other_position = 0;
+	self->consumer.offset = 0;
+	
+	return true;
+}
+
+static size_t * block_length(byte_ring_impl * self, size_t position)
+{
+	return (size_t *)(self->memory + (position % self->block_count) * BYTE_RING_BLOCK_STRIDE(self->block_size));
+}
+
+static unsigned char * block_data(byte_ring_impl * self, size_t position)
+{
+	return (unsigned char *)(block_length(self, position) + 1);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// byte_sink, used by the producer
+
+static void * byte_sink_acquire_impl(byte_ring_impl * self, size_t size)
+{
+	size_t position = atomic_load_explicit(&self->producer.position, memory_order_relaxed);
+	
+	if(size > self->block_size){
+		return NULL;
+	}
+	
+	// all blocks are used, check if the consumer has released some since we've looked last time
+	if(position - self->producer.other_position >= self->block_count){
+		self->producer.other_position = atomic_load_explicit(&self->consumer.position, memory_order_acquire);
+		
+		if(position - self->producer.other_position >= self->block_count){
+			return NULL;
+		}
+	}
+	
+	return block_data(self, position);
+}
+
+static void byte_sink_commit_impl(byte_ring_impl * self, size_t length)
+{
+	size_t position = atomic_load_explicit(&self->producer.position, memory_order_relaxed);
+	
+	// more than a block can't have been written to the memory of acquire, it's rejected
+	//	so the consumer never reads behind the block
+	if(!length || length > self->block_size){
+		return;
+	}
+	
+	*block_length(self, position) = length;
+	atomic_store_explicit(&self->producer.position, position + 1, memory_order_release);
+}
+
+static void byte_sink_close_impl(byte_ring_impl * self)
+{
+	atomic_store_explicit(&self->closed, true, memory_order_release);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// byte_source, used by the consumer
+
+static const void * byte_source_acquire_impl(byte_ring_impl * self, size_t * length)
+{
+	size_t position = atomic_load_explicit(&self->consumer.position, memory_order_relaxed);
+	
+	// all blocks are read, check if the producer has committed some since we've looked last time
+	if(position == self->consumer.other_position){
+		self->consumer.other_position = atomic_load_explicit(&self->producer.position, memory_order_acquire);
+		
+		if(position == self->consumer.other_position){
+			*length = 0;
+			return NULL;
+		}
+	}
+	
+	*length = *block_length(self, position) - self->consumer.offset;
+	return block_data(self, position) + self->consumer.offset;
+}
+
+static void byte_source_commit_impl(byte_ring_impl * self, size_t length)
+{
+	size_t position = atomic_load_explicit(&self->consumer.position, memory_order_relaxed);
+	
+	self->consumer.offset += length;
+	
+	// the block is read completely, pass it back to the producer
+	if(self->consumer.offset >= *block_length(self, position)){
+		self->consumer.offset = 0;
+		atomic_store_explicit(&self->consumer.position, position + 1, memory_order_release);
+	}
+}
+
+static bool byte_source_is_closed_impl(byte_ring_impl * self)
+{
+	// closed needs to be read first, the producer may commit before closing
+	if(!atomic_load_explicit(&self->closed, memory_order_acquire)){
+		return false;
+	}
+	
+	return atomic_load_explicit(&self->consumer.position, memory_order_relaxed)
+		== atomic_load_explicit(&self->producer.position, memory_order_acquire);
+}
@@ -0,0 +1,68 @@
+#ifndef BYTE_RING_H_
+#define BYTE_RING_H_
+
+#include <stddef.h>
+#include <stdatomic.h>
+
+// A single-producer single-consumer ring of preallocated blocks. The producer
+// writes into the blocks (byte_sink), the consumer reads from them (byte_source),
+// without copying and without locks. The producer and consumer may run on different threads.
+//
+// The memory of the blocks is passed to the initializer, use BYTE_RING_MEMORY_SIZE:
+//
+//	static byte_ring ring;
+//	static max_align_t ring_memory[BYTE_RING_MEMORY_SIZE(512, 8) / sizeof(max_align_t)];
+//	byte_ring_initialize(&ring, ring_memory, 512, 8);
+
+#define BYTE_RING_CACHE_LINE	64
+
+// the memory of a block: the length, followed by the data
+#define BYTE_RING_BLOCK_STRIDE(block_size)	\
+	((sizeof(size_t) + (block_size) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t))
+
+#define BYTE_RING_MEMORY_SIZE(block_size, block_count)	\
+	(BYTE_RING_BLOCK_STRIDE(block_size) * (block_count))
+
+// the producer and the consumer use their own cache-line
+typedef struct byte_ring_cursor {
+	// number of blocks committed by this side, written by this side only
+	_Alignas(BYTE_RING_CACHE_LINE) atomic_size_t position;
+	
+	// the last position of the other side seen, to avoid reading the other cache-line
+	size_t other_position;
+	
+	// the bytes of the current block already read (consumer only)
+	size_t offset;
+	
+} byte_ring_cursor;
+
+#define COBJ_CLASS_NAME	byte_ring
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(void *, memory)	\
+	COBJ_CLASS_PARAMETER(size_t, block_size)	\
+	COBJ_CLASS_PARAMETER(size_t, block_count)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(unsigned char *, memory)	\
+	COBJ_CLASS_VARIABLE(size_t, block_size)	\
+	COBJ_CLASS_VARIABLE(size_t, block_count)	\
+	COBJ_CLASS_VARIABLE(atomic_bool, closed)	\
+	COBJ_CLASS_VARIABLE(byte_ring_cursor, producer)	\
+	COBJ_CLASS_VARIABLE(byte_ring_cursor, consumer)	\
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(byte_sink)	\
+	COBJ_CLASS_INTERFACE(byte_source)	\
+
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#	include "interfaces/byte_sink.h"
+#	include "interfaces/byte_source.h"
+#undef  COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+
+#include "cobj-classheader-generator.h"
+
+
+#endif /* BYTE_RING_H_ */
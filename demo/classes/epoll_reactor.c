@@ -0,0 +1,182 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "epoll_reactor.h"
+
+#include "utils.h"
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+_Static_assert((uint32_t)event_readable == EPOLLIN && (uint32_t)event_writable == EPOLLOUT
+	&& (uint32_t)event_error == EPOLLERR && (uint32_t)event_hangup == EPOLLHUP,
+	"event_flags are passed to epoll as they are");
+
+static bool initialize_impl(epoll_reactor_impl * self)
+{
+	self->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	self->stopped = false;
+	self->pending = NULL;
+	self->events = NULL;
+	self->events_count = 0;
+	
+	return self->epoll_fd >= 0;
+}
+
+static void push_pending(epoll_reactor_impl * self, epoll_reactor_registration * registration)
+{
+	if(!registration->pending){
+		registration->pending = true;
+		registration->next_pending = self->pending;
+		self->pending = registration;
+	}
+}
+
+// applies the changes of the sources to epoll, a source failing is called with event_error
+static void apply_pending(epoll_reactor_impl * self)
+{
+	while(self->pending){
+		epoll_reactor_registration * registration = self->pending;
+		self->pending = registration->next_pending;
+		registration->pending = false;
+		
+		uint32_t interest = event_source_interest(&registration->source);
+		if(registration->registered && interest == registration->interest){
+			continue;
+		}
+		
+		struct epoll_event event = { .events = interest, .data.ptr = registration };
+		int operation = registration->registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+		
+		if(epoll_ctl(self->epoll_fd, operation, event_source_fd(&registration->source), &event)){
+			event_source_on_ready(&registration->source, event_error);
+			continue;
+		}
+		
+		registration->interest = interest;
+		registration->registered = true;
+	}
+}
+
+void epoll_reactor_add(epoll_reactor * object, epoll_reactor_registration * registration, const event_source * source)
+{
+	epoll_reactor_impl * self = (epoll_reactor_impl *)object;
+	
+	registration->source = *source;
+	registration->interest = 0;
+	registration->registered = false;
+	registration->pending = false;
+	
+	push_pending(self, registration);
+}
+
+void epoll_reactor_modify(epoll_reactor * object, epoll_reactor_registration * registration)
+{
+	push_pending((epoll_reactor_impl *)object, registration);
+}
+
+void epoll_reactor_remove(epoll_reactor * object, epoll_reactor_registration * registration)
+{
+	epoll_reactor_impl * self = (epoll_reactor_impl *)object;
+	
+	if(registration->pending){
+		epoll_reactor_registration ** link = &self->pending;
+		while(*link != registration){
+			link = &(*link)->next_pending;
+		}
+		
+		*link = registration->next_pending;
+		registration->pending = false;
+	}
+	
+	if(registration->registered){
+		epoll_ctl(self->epoll_fd, EPOLL_CTL_DEL, event_source_fd(&registration->source), NULL);
+		registration->registered = false;
+	}
+	
+	// the events not dispatched yet may contain the source
+	for(int i = 0; i < self->events_count; i++){
+		if(self->events[i].data.ptr == registration){
+			self->events[i].data.ptr = NULL;
+		}
+	}
+}
+
+int epoll_reactor_run_once(epoll_reactor * object, int timeout)
+{
+	epoll_reactor_impl * self = (epoll_reactor_impl *)object;
+	struct epoll_event events[EPOLL_REACTOR_EVENTS];
+	
+	apply_pending(self);
+	
+	int count = epoll_wait(self->epoll_fd, events, EPOLL_REACTOR_EVENTS, timeout);
+	if(count < 0){
+		return errno == EINTR ? 0 : -1;
+	}
+	
+	self->events = events;
+	self->events_count = count;
+	
+	for(int i = 0; i < count; i++){
+		epoll_reactor_registration * registration = events[i].data.ptr;
+		
+		if(!registration){
+			continue;
+		}
+		
+		event_source_on_ready(&registration->source, events[i].events);
+		
+		// epoll reports errors and hangups until the fd is closed, so the source is removed,
+		//	unless on_ready removed it already
+		if(events[i].events & (event_error | event_hangup) && events[i].data.ptr){
+			epoll_reactor_remove(object, registration);
+		}
+	}
+	
+	self->events = NULL;
+	self->events_count = 0;
+	
+	return count;
+}
+
+void epoll_reactor_run(epoll_reactor * object)
+{
+	epoll_reactor_impl * self = (epoll_reactor_impl *)object;
+	
+	self->stopped = false;
+	
+	while(!self->stopped && epoll_reactor_run_once(object, -1) >= 0){
+	}
+}
+
+void epoll_reactor_stop(epoll_reactor * object)
+{
+	((epoll_reactor_impl *)object)->stopped = true;
+}
+
+void epoll_reactor_close(epoll_reactor * object)
+{
+	epoll_reactor_impl * self = (epoll_reactor_impl *)object;
+	
+	close(self->epoll_fd);
+	self->epoll_fd = -1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// event_source, the epoll file descriptor is readable if a source is ready
+
+static int event_source_fd_impl(epoll_reactor_impl * self)
+{
+	return self->epoll_fd;
+}
+
+static uint32_t event_source_interest_impl(epoll_reactor_impl * self)
+{
+	UNUSED_PARAMETER(self);
+	return event_readable;
+}
+
+static void event_source_on_ready_impl(epoll_reactor_impl * self, uint32_t events)
+{
+	UNUSED_PARAMETER(events);
+	epoll_reactor_run_once((epoll_reactor *)self, 0);
+}
@@ -0,0 +1,88 @@
+#ifndef EPOLL_REACTOR_H_
+#define EPOLL_REACTOR_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct epoll_event;
+
+// the events read by one call of epoll_wait
+#define EPOLL_REACTOR_EVENTS	64
+
+// Waits for many event_sources at once (Linux only), and calls their on_ready method.
+// Adding and modifying sources is deferred until the reactor waits the next time, so a source
+// changed many times (like a connection toggling it's interest in writing) costs one epoll_ctl.
+// Sources may be added, modified and removed by the on_ready methods, a removed source is not called anymore.
+// A source reporting an error or a hangup is removed after it's on_ready was called, so it's fd may be
+// closed by on_ready, or added again after it was reopened.
+//
+//	static epoll_reactor reactor;
+//	static timerfd_source tick;
+//	static epoll_reactor_registration tick_registration;
+//	event_source tick_source;
+//
+//	epoll_reactor_initialize(&reactor);
+//	timerfd_source_initialize(&tick, 1000000, &on_tick, NULL);
+//	event_source_queryinterface(&tick.object, &tick_source);
+//	epoll_reactor_add(&reactor, &tick_registration, &tick_source);
+//	epoll_reactor_run(&reactor);
+//
+// The reactor is an event_source itself, which is ready if one of it's sources is ready,
+// so reactors can be nested. A reactor is used by one thread, use one reactor per core.
+#define COBJ_CLASS_NAME	epoll_reactor
+
+#define COBJ_CLASS_PARAMETERS
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(int, epoll_fd)	\
+	COBJ_CLASS_VARIABLE(bool, stopped)	\
+	COBJ_CLASS_VARIABLE(struct epoll_reactor_registration *, pending)	\
+	COBJ_CLASS_VARIABLE(struct epoll_event *, events)	\
+	COBJ_CLASS_VARIABLE(int, events_count)	\
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(event_source)	\
+
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#	include "interfaces/event_source.h"
+#undef  COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+// A source registered with a reactor. It's owned by the caller, and must be valid until it's removed.
+typedef struct epoll_reactor_registration {
+	event_source source;
+	
+	// the interest known by epoll, if it's registered
+	uint32_t interest;
+	bool registered;
+	
+	// changed since the last call of epoll_wait
+	bool pending;
+	struct epoll_reactor_registration * next_pending;
+} epoll_reactor_registration;
+
+
+#include "cobj-classheader-generator.h"
+
+// adds the source, it's interest is read when the reactor waits the next time
+void epoll_reactor_add(epoll_reactor * self, epoll_reactor_registration * registration, const event_source * source);
+
+// reads the interest of the source again, when the reactor waits the next time
+void epoll_reactor_modify(epoll_reactor * self, epoll_reactor_registration * registration);
+
+// removes the source immediately, so it's file descriptor may be closed afterwards
+void epoll_reactor_remove(epoll_reactor * self, epoll_reactor_registration * registration);
+
+// waits up to timeout milliseconds (-1 forever), and calls the sources which are ready.
+//	Returns the number of events, or -1 on errors.
+int epoll_reactor_run_once(epoll_reactor * self, int timeout);
+
+// calls epoll_reactor_run_once until epoll_reactor_stop is called (by a source)
+void epoll_reactor_run(epoll_reactor * self);
+void epoll_reactor_stop(epoll_reactor * self);
+
+void epoll_reactor_close(epoll_reactor * self);
+
+
+#endif /* EPOLL_REACTOR_H_ */
@@ -0,0 +1,52 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "eventfd_source.h"
+
+#include "utils.h"
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+static bool initialize_impl(eventfd_source_impl * self, event_callback callback, void * context)
+{
+	self->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	self->callback = callback;
+	self->context = context;
+	
+	return self->fd >= 0;
+}
+
+bool eventfd_source_signal(eventfd_source * object, uint64_t value)
+{
+	eventfd_source_impl * self = (eventfd_source_impl *)object;
+	
+	return write(self->fd, &value, sizeof(value)) == sizeof(value);
+}
+
+void eventfd_source_close(eventfd_source * object)
+{
+	eventfd_source_impl * self = (eventfd_source_impl *)object;
+	
+	close(self->fd);
+	self->fd = -1;
+}
+
+static int event_source_fd_impl(eventfd_source_impl * self)
+{
+	return self->fd;
+}
+
+static uint32_t event_source_interest_impl(eventfd_source_impl * self)
+{
+	UNUSED_PARAMETER(self);
+	return event_readable;
+}
+
+static void event_source_on_ready_impl(eventfd_source_impl * self, uint32_t events)
+{
+	UNUSED_PARAMETER(events);
+	uint64_t value;
+	
+	if(read(self->fd, &value, sizeof(value)) == sizeof(value) && self->callback){
+		self->callback(self->context, value);
+	}
+}
@@ -0,0 +1,38 @@
+#ifndef EVENTFD_SOURCE_H_
+#define EVENTFD_SOURCE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// A counter (Linux eventfd) for a reactor (see epoll_reactor.h), to wake it from other threads.
+// eventfd_source_signal adds to the counter, the callback is called by the reactor with
+// the sum of the values signaled since it was called the last time.
+#define COBJ_CLASS_NAME	eventfd_source
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(event_callback, callback)	\
+	COBJ_CLASS_PARAMETER(void *, context)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(int, fd)	\
+	COBJ_CLASS_VARIABLE(event_callback, callback)	\
+	COBJ_CLASS_VARIABLE(void *, context)	\
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(event_source)	\
+
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#	include "interfaces/event_source.h"
+#undef  COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+
+#include "cobj-classheader-generator.h"
+
+// adds value (> 0) to the counter, this may be called by any thread
+bool eventfd_source_signal(eventfd_source * self, uint64_t value);
+
+void eventfd_source_close(eventfd_source * self);
+
+
+#endif /* EVENTFD_SOURCE_H_ */
@@ -0,0 +1,54 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "gpio_event_poller.h"
+
+static uint32_t read_levels(gpio_event_poller_impl * self)
+{
+	uint32_t levels = 0;
+	
+	for(size_t pin_nr = 0; pin_nr < self->pin_count; pin_nr++){
+		levels |= (uint32_t)gpio_pin_get_value(&self->pins[pin_nr]) << pin_nr;
+	}
+	
+	return levels;
+}
+
+static bool initialize_impl(gpio_event_poller_impl * self, const gpio_pin * pins, size_t pin_count)
+{
+	if(pin_count > 32){
+		return false;
+	}
+	
+	self->pins = pins;
+	self->pin_count = pin_count;
+	self->levels = read_levels(self);
+	gpio_subscriber_list_initialize(&self->subscribers);
+	
+	return true;
+}
+
+static bool gpio_event_source_subscribe_impl(gpio_event_poller_impl * self, gpio_event_subscription * subscription)
+{
+	return gpio_subscriber_list_subscribe(&self->subscribers, subscription);
+}
+
+static void gpio_event_source_unsubscribe_impl(gpio_event_poller_impl * self, gpio_event_subscription * subscription)
+{
+	gpio_subscriber_list_unsubscribe(&self->subscribers, subscription);
+}
+
+bool gpio_event_poller_poll(gpio_event_poller * object)
+{
+	gpio_event_poller_impl * self = (gpio_event_poller_impl *)object;
+	
+	uint32_t levels = read_levels(self);
+	uint32_t changed = levels ^ self->levels;
+	
+	if(!changed){
+		return false;
+	}
+	
+	self->levels = levels;
+	gpio_subscriber_list_dispatch(&self->subscribers, changed, levels);
+	return true;
+}
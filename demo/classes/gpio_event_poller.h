@@ -0,0 +1,44 @@
+#ifndef GPIO_EVENT_POLLER_H_
+#define GPIO_EVENT_POLLER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "interfaces/gpio_pin.h"
+#include "events/gpio_subscriber_list.h"
+
+// Raises the events of up to 32 gpio_pins without interrupts (pin n of the source is pins[n]).
+// gpio_event_poller_poll reads all pins in one loop, and calls the subscribers only if a
+// level has changed, so the consumers of the events don't need to poll the pins themselves.
+//
+// gpio_pin.h is needed for the arguments only, so it's included before
+// defining COBJ_INTERFACE_IMPLEMENTATION_MODE.
+#define COBJ_CLASS_NAME	gpio_event_poller
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(const gpio_pin *, pins)	\
+	COBJ_CLASS_PARAMETER(size_t, pin_count)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(const gpio_pin *, pins)	\
+	COBJ_CLASS_VARIABLE(size_t, pin_count)	\
+	COBJ_CLASS_VARIABLE(uint32_t, levels)	\
+	COBJ_CLASS_VARIABLE(gpio_subscriber_list, subscribers)	\
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(gpio_event_source)	\
+
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#	include "interfaces/gpio_event_source.h"
+#undef  COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+
+#include "cobj-classheader-generator.h"
+
+// reads the pins, and raises the events. Returns true if a level has changed.
+bool gpio_event_poller_poll(gpio_event_poller * self);
+
+
+#endif /* GPIO_EVENT_POLLER_H_ */
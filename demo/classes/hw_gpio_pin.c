@@ -4,10 +4,7 @@
 #include "hw_gpio_pin.h"
 
 //////////////////////////////////////////////////////////////////////////
-// hardware configuration symbols (just those needed for the demo)
-
-#define HW_GPIO_REGISTER_ADDRESS				0xFFFF1000
-#define HW_GPIO_REGISTER_SIZE					0x100
+// hardware registers (just those needed for the demo)
 
 typedef struct gpio_port_registerfile {
           unsigned long                  reserved[16];
@@ -39,11 +36,11 @@ typedef struct gpio_port_registerfile {
 
 static bool initialize_impl(hw_gpio_pin_impl * self, int pin_nr)
 {
-	int port_nr = pin_nr >> 5;
-	int pin_offset = pin_nr & 0x1F;
-
-	self->port_address = HW_GPIO_REGISTER_ADDRESS + port_nr * HW_GPIO_REGISTER_SIZE;
-	self->port_mask = 1 << pin_offset;
+	// the same variables as a static object (HW_GPIO_PIN_STATIC_VARIABLES), the class_descriptor is already set
+	*self = (hw_gpio_pin_impl){
+		.class_desriptor = self->class_desriptor,
+		HW_GPIO_PIN_STATIC_VARIABLES(pin_nr)
+	};
 
 	return true;
 }
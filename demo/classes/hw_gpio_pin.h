@@ -21,6 +21,20 @@
 
 #include "cobj-classheader-generator.h"
 
+//////////////////////////////////////////////////////////////////////////
+// hardware configuration symbols (just those needed for the demo)
+
+#define HW_GPIO_REGISTER_ADDRESS				0xFFFF1000
+#define HW_GPIO_REGISTER_SIZE					0x100
+
+#define HW_GPIO_PORT_ADDRESS(pin_nr)			(HW_GPIO_REGISTER_ADDRESS + ((pin_nr) >> 5) * HW_GPIO_REGISTER_SIZE)
+#define HW_GPIO_PORT_MASK(pin_nr)				(1 << ((pin_nr) & 0x1F))
+
+// the variables for COBJ_STATIC_OBJECT, initialize_impl sets them by this macro too
+#define HW_GPIO_PIN_STATIC_VARIABLES(pin_nr)	\
+	.port_address = HW_GPIO_PORT_ADDRESS(pin_nr),	\
+	.port_mask = HW_GPIO_PORT_MASK(pin_nr)
+
 
 
 #endif /* HW_GPIO_PIN_H_ */
\ No newline at end of file
@@ -0,0 +1,54 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "sim_gpio_port.h"
+
+static bool initialize_impl(sim_gpio_port_impl * self)
+{
+	atomic_init(&self->levels, 0);
+	gpio_subscriber_list_initialize(&self->subscribers);
+	
+	return true;
+}
+
+static bool gpio_event_source_subscribe_impl(sim_gpio_port_impl * self, gpio_event_subscription * subscription)
+{
+	return gpio_subscriber_list_subscribe(&self->subscribers, subscription);
+}
+
+static void gpio_event_source_unsubscribe_impl(sim_gpio_port_impl * self, gpio_event_subscription * subscription)
+{
+	gpio_subscriber_list_unsubscribe(&self->subscribers, subscription);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// simulation
+
+void sim_gpio_port_set_levels(sim_gpio_port * object, uint32_t levels)
+{
+	sim_gpio_port_impl * self = (sim_gpio_port_impl *)object;
+	
+	uint32_t changed = atomic_exchange(&self->levels, levels) ^ levels;
+	if(changed){
+		gpio_subscriber_list_dispatch(&self->subscribers, changed, levels);
+	}
+}
+
+bool sim_gpio_port_set_level(sim_gpio_port * object, int pin_nr, bool value)
+{
+	sim_gpio_port_impl * self = (sim_gpio_port_impl *)object;
+	
+	if(pin_nr < 0 || pin_nr >= SIM_GPIO_PORT_PIN_COUNT){
+		return false;
+	}
+	
+	uint32_t mask = UINT32_C(1) << pin_nr;
+	uint32_t old_levels = value ? atomic_fetch_or(&self->levels, mask) : atomic_fetch_and(&self->levels, ~mask);
+	uint32_t levels = value ? old_levels | mask : old_levels & ~mask;
+	
+	// the pin may have had the level before
+	if(levels != old_levels){
+		gpio_subscriber_list_dispatch(&self->subscribers, mask, levels);
+	}
+	
+	return true;
+}
@@ -0,0 +1,40 @@
+#ifndef SIM_GPIO_PORT_H_
+#define SIM_GPIO_PORT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "events/gpio_subscriber_list.h"
+
+// A simulated port of 32 pins, raising events when the simulated levels change,
+// the same way an interrupt-controller does. The levels are changed by the
+// simulation (or a test) with sim_gpio_port_set_levels / sim_gpio_port_set_level,
+// the events are raised on the calling thread.
+
+#define SIM_GPIO_PORT_PIN_COUNT	32
+
+#define COBJ_CLASS_NAME	sim_gpio_port
+
+#define COBJ_CLASS_PARAMETERS
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(_Atomic uint32_t, levels)	\
+	COBJ_CLASS_VARIABLE(gpio_subscriber_list, subscribers)	\
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(gpio_event_source)	\
+
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#	include "interfaces/gpio_event_source.h"
+#undef  COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+
+#include "cobj-classheader-generator.h"
+
+void sim_gpio_port_set_levels(sim_gpio_port * self, uint32_t levels);
+// returns false if pin_nr is not in 0..SIM_GPIO_PORT_PIN_COUNT-1
+bool sim_gpio_port_set_level(sim_gpio_port * self, int pin_nr, bool value);
+
+
+#endif /* SIM_GPIO_PORT_H_ */
@@ -17,4 +17,10 @@ static int console_vprintf_impl(stdconsole_impl * self, const char * format, va_
 {
 	UNUSED_PARAMETER(self);
 	return vprintf(format, vlist);
+}
+
+static size_t writer_write_impl(stdconsole_impl * self, const char * buffer, size_t length)
+{
+	UNUSED_PARAMETER(self);
+	return fwrite(buffer, 1, length, stdout);
 }
\ No newline at end of file
@@ -0,0 +1,69 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "timerfd_source.h"
+
+#include "utils.h"
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+static struct timespec to_timespec(uint64_t ns)
+{
+	struct timespec time = { .tv_sec = (time_t)(ns / 1000000000u), .tv_nsec = (long)(ns % 1000000000u) };
+	return time;
+}
+
+static bool initialize_impl(timerfd_source_impl * self, uint64_t interval_ns, event_callback callback, void * context)
+{
+	self->fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	self->callback = callback;
+	self->context = context;
+	
+	if(self->fd < 0){
+		return false;
+	}
+	
+	if(!timerfd_source_set((timerfd_source *)self, interval_ns, interval_ns)){
+		timerfd_source_close((timerfd_source *)self);
+		return false;
+	}
+	
+	return true;
+}
+
+bool timerfd_source_set(timerfd_source * object, uint64_t initial_ns, uint64_t interval_ns)
+{
+	timerfd_source_impl * self = (timerfd_source_impl *)object;
+	
+	struct itimerspec timer = { .it_interval = to_timespec(interval_ns), .it_value = to_timespec(interval_ns ? initial_ns : 0) };
+	return timerfd_settime(self->fd, 0, &timer, NULL) == 0;
+}
+
+void timerfd_source_close(timerfd_source * object)
+{
+	timerfd_source_impl * self = (timerfd_source_impl *)object;
+	
+	close(self->fd);
+	self->fd = -1;
+}
+
+static int event_source_fd_impl(timerfd_source_impl * self)
+{
+	return self->fd;
+}
+
+static uint32_t event_source_interest_impl(timerfd_source_impl * self)
+{
+	UNUSED_PARAMETER(self);
+	return event_readable;
+}
+
+static void event_source_on_ready_impl(timerfd_source_impl * self, uint32_t events)
+{
+	UNUSED_PARAMETER(events);
+	uint64_t expirations;
+	
+	// another reader may have read it already (EAGAIN)
+	if(read(self->fd, &expirations, sizeof(expirations)) == sizeof(expirations) && self->callback){
+		self->callback(self->context, expirations);
+	}
+}
@@ -0,0 +1,39 @@
+#ifndef TIMERFD_SOURCE_H_
+#define TIMERFD_SOURCE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// A periodic timer (Linux timerfd), for a reactor (see epoll_reactor.h). The callback is called
+// with the number of expirations since it was called the last time, which is more than 1 if
+// the reactor was late. An interval of 0 disarms the timer.
+#define COBJ_CLASS_NAME	timerfd_source
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(uint64_t, interval_ns)	\
+	COBJ_CLASS_PARAMETER(event_callback, callback)	\
+	COBJ_CLASS_PARAMETER(void *, context)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(int, fd)	\
+	COBJ_CLASS_VARIABLE(event_callback, callback)	\
+	COBJ_CLASS_VARIABLE(void *, context)	\
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(event_source)	\
+
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#	include "interfaces/event_source.h"
+#undef  COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+
+#include "cobj-classheader-generator.h"
+
+// restarts the timer, it expires first after initial_ns, and then every interval_ns
+bool timerfd_source_set(timerfd_source * self, uint64_t initial_ns, uint64_t interval_ns);
+
+void timerfd_source_close(timerfd_source * self);
+
+
+#endif /* TIMERFD_SOURCE_H_ */
@@ -0,0 +1,293 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "timing_wheel.h"
+
+#define SLOT_MASK	((uint64_t)TIMING_WHEEL_SLOTS - 1)
+
+// the ticks covered by the levels
+#define TIMING_WHEEL_RANGE	((uint64_t)1 << (TIMING_WHEEL_LEVELS * TIMING_WHEEL_BITS))
+
+static bool initialize_impl(timing_wheel_impl * self, struct timing_wheel_node * nodes, size_t node_count)
+{
+	if(node_count >= TIMING_WHEEL_NIL){
+		return false;
+	}
+	
+	self->now = 0;
+	self->nodes = nodes;
+	self->node_count = node_count;
+	self->pending_count = 0;
+	self->advancing = false;
+	self->deferred_ticks = 0;
+	self->free_nodes = TIMING_WHEEL_NIL;
+	
+	for(size_t i = node_count; i > 0; i--){
+		nodes[i - 1].generation = 1;
+		nodes[i - 1].slot = TIMING_WHEEL_NIL;
+		nodes[i - 1].next = self->free_nodes;
+		self->free_nodes = (uint32_t)(i - 1);
+	}
+	
+	for(size_t i = 0; i < TIMING_WHEEL_LEVELS * TIMING_WHEEL_SLOTS; i++){
+		self->slots[i] = TIMING_WHEEL_NIL;
+	}
+	
+	for(size_t i = 0; i < TIMING_WHEEL_LEVELS; i++){
+		self->occupied[i] = 0;
+	}
+	
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// the lists of the slots
+
+// the lowest level, where the slots are shorter than the time until the timer expires
+static uint32_t slot_of(timing_wheel_impl * self, uint64_t expires)
+{
+	uint64_t delta = expires - self->now;
+	uint32_t level = 0;
+	
+	if(delta >= TIMING_WHEEL_RANGE){
+		// it waits in the last slot of the top level, until it's moved down
+		expires = self->now + TIMING_WHEEL_RANGE - 1;
+		delta = TIMING_WHEEL_RANGE - 1;
+	}
+	
+	while(delta >> ((level + 1) * TIMING_WHEEL_BITS)){
+		level++;
+	}
+	
+	return level * TIMING_WHEEL_SLOTS + (uint32_t)((expires >> (level * TIMING_WHEEL_BITS)) & SLOT_MASK);
+}
+
+static void link_node(timing_wheel_impl * self, uint32_t index)
+{
+	timing_wheel_node * node = &self->nodes[index];
+	uint32_t slot = slot_of(self, node->expires);
+	
+	node->slot = slot;
+	node->previous = TIMING_WHEEL_NIL;
+	node->next = self->slots[slot];
+	
+	if(node->next != TIMING_WHEEL_NIL){
+		self->nodes[node->next].previous = index;
+	}
+	
+	self->slots[slot] = index;
+	self->occupied[slot / TIMING_WHEEL_SLOTS] |= (uint64_t)1 << (slot % TIMING_WHEEL_SLOTS);
+}
+
+static void unlink_node(timing_wheel_impl * self, uint32_t index)
+{
+	timing_wheel_node * node = &self->nodes[index];
+	
+	if(node->previous != TIMING_WHEEL_NIL){
+		self->nodes[node->previous].next = node->next;
+	} else {
+		self->slots[node->slot] = node->next;
+		
+		if(node->next == TIMING_WHEEL_NIL){
+			self->occupied[node->slot / TIMING_WHEEL_SLOTS] &= ~((uint64_t)1 << (node->slot % TIMING_WHEEL_SLOTS));
+		}
+	}
+	
+	if(node->next != TIMING_WHEEL_NIL){
+		self->nodes[node->next].previous = node->previous;
+	}
+	
+	node->slot = TIMING_WHEEL_NIL;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// the pool of the nodes
+
+static uint32_t allocate_node(timing_wheel_impl * self, uint64_t expires, uint64_t interval, scheduler_callback callback, void * context)
+{
+	uint32_t index = self->free_nodes;
+	
+	if(index == TIMING_WHEEL_NIL){
+		return TIMING_WHEEL_NIL;
+	}
+	
+	timing_wheel_node * node = &self->nodes[index];
+	self->free_nodes = node->next;
+	self->pending_count++;
+	
+	node->expires = expires;
+	node->interval = interval;
+	node->callback = callback;
+	node->context = context;
+	
+	return index;
+}
+
+static void free_node(timing_wheel_impl * self, uint32_t index)
+{
+	timing_wheel_node * node = &self->nodes[index];
+	
+	// the generation 0 is skipped, so a scheduler_timer is never 0
+	if(++node->generation == 0){
+		node->generation = 1;
+	}
+	
+	node->next = self->free_nodes;
+	self->free_nodes = index;
+	self->pending_count--;
+}
+
+static scheduler_timer timer_of(timing_wheel_impl * self, uint32_t index)
+{
+	return ((uint64_t)self->nodes[index].generation << 32) | index;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// ticks
+
+// moves the timers of the slot to the lower levels
+static void cascade(timing_wheel_impl * self, uint32_t slot)
+{
+	while(self->slots[slot] != TIMING_WHEEL_NIL){
+		uint32_t index = self->slots[slot];
+		unlink_node(self, index);
+		link_node(self, index);
+	}
+}
+
+static void tick(timing_wheel_impl * self)
+{
+	uint64_t now = ++self->now;
+	
+	// the slot of a level is moved down, when the level below has wrapped around
+	for(uint32_t level = 1; level < TIMING_WHEEL_LEVELS; level++){
+		if((now >> ((level - 1) * TIMING_WHEEL_BITS)) & SLOT_MASK){
+			break;
+		}
+		
+		cascade(self, level * TIMING_WHEEL_SLOTS + (uint32_t)((now >> (level * TIMING_WHEEL_BITS)) & SLOT_MASK));
+	}
+	
+	// all timers of the slot expire now. Timers scheduled by the callbacks expire later, so they
+	// are never added to this slot, but timers of this slot may be cancelled.
+	uint32_t slot = (uint32_t)(now & SLOT_MASK);
+	
+	while(self->slots[slot] != TIMING_WHEEL_NIL){
+		uint32_t index = self->slots[slot];
+		timing_wheel_node * node = &self->nodes[index];
+		
+		unlink_node(self, index);
+		node->callback(node->context);
+		
+		// the interval is cleared, if the timer is cancelled by the callback
+		if(node->interval){
+			node->expires += node->interval;
+			link_node(self, index);
+		} else {
+			free_node(self, index);
+		}
+	}
+}
+
+void timing_wheel_advance(timing_wheel * object, uint64_t ticks)
+{
+	timing_wheel_impl * self = (timing_wheel_impl *)object;
+	
+	// called by a timer, the tick running isn't finished yet
+	if(self->advancing){
+		self->deferred_ticks += ticks;
+		return;
+	}
+	
+	self->advancing = true;
+	
+	while(ticks){
+		// the levels below the lowest level with timers are empty, so nothing happens until the
+		// tick moving down the timers of the next slot of this level
+		uint32_t level = 0;
+		while(level < TIMING_WHEEL_LEVELS && !self->occupied[level]){
+			level++;
+		}
+		
+		// an empty wheel doesn't need to turn
+		if(level == TIMING_WHEEL_LEVELS){
+			self->now += ticks;
+			ticks = 0;
+		} else {
+			uint64_t span = (uint64_t)1 << (level * TIMING_WHEEL_BITS);
+			uint64_t idle = span - 1 - (self->now & (span - 1));
+			
+			if(idle >= ticks){
+				self->now += ticks;
+				ticks = 0;
+			} else {
+				self->now += idle;
+				ticks -= idle + 1;
+				tick(self);
+			}
+		}
+		
+		ticks += self->deferred_ticks;
+		self->deferred_ticks = 0;
+	}
+	
+	self->advancing = false;
+}
+
+size_t timing_wheel_pending(const timing_wheel * object)
+{
+	return ((const timing_wheel_impl *)object)->pending_count;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// scheduler
+
+static scheduler_timer scheduler_schedule_at_impl(timing_wheel_impl * self, uint64_t time, scheduler_callback callback, void * context)
+{
+	uint32_t index = allocate_node(self, time > self->now ? time : self->now + 1, 0, callback, context);
+	
+	if(index == TIMING_WHEEL_NIL){
+		return 0;
+	}
+	
+	link_node(self, index);
+	return timer_of(self, index);
+}
+
+static scheduler_timer scheduler_schedule_every_impl(timing_wheel_impl * self, uint64_t interval, scheduler_callback callback, void * context)
+{
+	uint32_t index = interval ? allocate_node(self, self->now + interval, interval, callback, context) : TIMING_WHEEL_NIL;
+	
+	if(index == TIMING_WHEEL_NIL){
+		return 0;
+	}
+	
+	link_node(self, index);
+	return timer_of(self, index);
+}
+
+static bool scheduler_cancel_impl(timing_wheel_impl * self, scheduler_timer timer)
+{
+	uint32_t index = (uint32_t)timer;
+	
+	if(index >= self->node_count || self->nodes[index].generation != (uint32_t)(timer >> 32)){
+		return false;
+	}
+	
+	timing_wheel_node * node = &self->nodes[index];
+	
+	if(node->slot == TIMING_WHEEL_NIL){
+		// it's the timer running, it's freed after the callback
+		bool periodic = node->interval != 0;
+		node->interval = 0;
+		return periodic;
+	}
+	
+	unlink_node(self, index);
+	free_node(self, index);
+	return true;
+}
+
+static uint64_t scheduler_now_impl(timing_wheel_impl * self)
+{
+	return self->now;
+}
@@ -0,0 +1,93 @@
+#ifndef TIMING_WHEEL_H_
+#define TIMING_WHEEL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// the wheels of the hierarchy, each has 2^TIMING_WHEEL_BITS slots. The slots of level n are 2^(n*bits) ticks
+// long, so timers up to 2^(levels*bits) ticks ahead are sorted in (later ones wait in the last slot).
+#define TIMING_WHEEL_LEVELS	6
+#define TIMING_WHEEL_BITS	6
+#define TIMING_WHEEL_SLOTS	(1 << TIMING_WHEEL_BITS)
+
+// the end of a list of nodes
+#define TIMING_WHEEL_NIL	UINT32_MAX
+
+// the heads of the lists of nodes in the slots
+typedef uint32_t timing_wheel_slots[TIMING_WHEEL_LEVELS * TIMING_WHEEL_SLOTS];
+
+// a bit for each slot of a level, which is set if the slot has timers
+typedef uint64_t timing_wheel_occupied[TIMING_WHEEL_LEVELS];
+_Static_assert(TIMING_WHEEL_SLOTS <= 64, "the slots of a level are a bitmap");
+
+// A scheduler implemented by a hierarchical timing wheel. Scheduling and cancelling a timer is O(1),
+// a timer is moved to a lower level at most TIMING_WHEEL_LEVELS - 1 times, before it expires.
+// The timers expiring at a tick are called as a batch. Ticks without timers in the lower levels
+// are skipped, so a wheel with few timers is advanced quickly over long times.
+//
+// The wheel has no clock, it's advanced by the ticks elapsed. In tests it's advanced by the test,
+// so the timing is deterministic, at runtime by a clock (like a timerfd_source with the period of a tick):
+//
+//	static void on_tick(void * context, uint64_t expirations) {
+//		timing_wheel_advance(context, expirations);
+//	}
+//
+// The nodes of the timers are passed to the initializer, one for each timer pending at the same time. The timers may schedule and cancel timers.
+#define COBJ_CLASS_NAME	timing_wheel
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(struct timing_wheel_node *, nodes)	\
+	COBJ_CLASS_PARAMETER(size_t, node_count)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(uint64_t, now)	\
+	COBJ_CLASS_VARIABLE(struct timing_wheel_node *, nodes)	\
+	COBJ_CLASS_VARIABLE(size_t, node_count)	\
+	COBJ_CLASS_VARIABLE(uint32_t, free_nodes)	\
+	COBJ_CLASS_VARIABLE(size_t, pending_count)	\
+	COBJ_CLASS_VARIABLE(bool, advancing)	\
+	COBJ_CLASS_VARIABLE(uint64_t, deferred_ticks)	\
+	COBJ_CLASS_VARIABLE(timing_wheel_slots, slots)	\
+	COBJ_CLASS_VARIABLE(timing_wheel_occupied, occupied)	\
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(scheduler)	\
+
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#	include "interfaces/scheduler.h"
+#undef  COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+typedef struct timing_wheel_node {
+	uint64_t expires;
+	
+	// 0 for timers expiring once
+	uint64_t interval;
+	
+	scheduler_callback callback;
+	void * context;
+	
+	// the list of the slot, or of the free nodes
+	uint32_t next;
+	uint32_t previous;
+	
+	// incremented when the node is freed, so the scheduler_timer of an expired timer is not valid anymore
+	uint32_t generation;
+	
+	// the slot (level * TIMING_WHEEL_SLOTS + index), or TIMING_WHEEL_NIL if it's not in a slot
+	uint32_t slot;
+} timing_wheel_node;
+
+
+#include "cobj-classheader-generator.h"
+
+// processes the ticks elapsed, and calls the timers expired. If it's called by a timer, the ticks
+//	are processed after the current tick, by the call running already.
+void timing_wheel_advance(timing_wheel * self, uint64_t ticks);
+
+// the number of timers pending
+size_t timing_wheel_pending(const timing_wheel * self);
+
+
+#endif /* TIMING_WHEEL_H_ */
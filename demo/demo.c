@@ -4,32 +4,27 @@
 #include "classes/gpio_pin_inverter.h"
 #include "application/application.h"
 
-// this are the objects needed for the demo on real hardware
-static stdconsole console_object;
-static hw_gpio_pin input_pin_object;
-static hw_gpio_pin output_pin_object;
-static gpio_pin_inverter inverted_pin_object;
+// this are the objects needed for the demo on real hardware.
+// Everything is known at compile time, so the objects are defined with
+// constant initializers, and no initialize or queryinterface is called at startup.
+static COBJ_STATIC_OBJECT(stdconsole, console_object);
+static COBJ_STATIC_OBJECT(hw_gpio_pin, input_pin_object, HW_GPIO_PIN_STATIC_VARIABLES(13));
+static COBJ_STATIC_OBJECT(hw_gpio_pin, output_pin_object, HW_GPIO_PIN_STATIC_VARIABLES(14));
 
-int main()
-{
-
-	// initialize the hardware objects
-	stdconsole_initialize(&console_object);
-	hw_gpio_pin_initialize(&input_pin_object, 13);
-	hw_gpio_pin_initialize(&output_pin_object, 14);
+// the output-pin is driven logically inverted by the electronic schema,
+// so we wrap it in a gpio_pin_inverter to perform this transparent to the application
+static gpio_pin pin_physical = COBJ_STATIC_REFERENCE(gpio_pin, hw_gpio_pin, output_pin_object);
+static COBJ_STATIC_OBJECT(gpio_pin_inverter, inverted_pin_object, .pin = &pin_physical);
 
-	// get references to interfaces used by the application
-	console_queryinterface(&console_object.object, &application_resources.console);
-	gpio_pin_queryinterface(&input_pin_object.object, &application_resources.input_pin);
+// references to interfaces used by the application
+struct application_resources application_resources = {
+	.console = COBJ_STATIC_REFERENCE(console, stdconsole, console_object),
+	.input_pin = COBJ_STATIC_REFERENCE(gpio_pin, hw_gpio_pin, input_pin_object),
+	.output_pin = COBJ_STATIC_REFERENCE(gpio_pin, gpio_pin_inverter, inverted_pin_object),
+};
 
-	// the output-pin is driven logically inverted by the electronic schema,
-	// so we wrap it in a gpio_pin_inverter to perform this transparent to the application
-	gpio_pin pin_physical;
-	gpio_pin_queryinterface(&output_pin_object.object, &pin_physical);
-
-	gpio_pin_inverter_initialize(&inverted_pin_object, &pin_physical);
-	gpio_pin_queryinterface(&inverted_pin_object.object, &application_resources.output_pin);
-	
+int main()
+{
 	// start the show!
 	application_run();
-}
\ No newline at end of file
+}
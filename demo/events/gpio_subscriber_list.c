@@ -0,0 +1,147 @@
+#include "gpio_subscriber_list.h"
+
+#include "interfaces/gpio_event_source.h"
+
+#include <sched.h>
+
+// the spins of a writer, before it yields the cpu to the thread it waits for
+#define GPIO_SUBSCRIBER_LIST_SPINS	64
+
+void gpio_subscriber_list_initialize(gpio_subscriber_list * self)
+{
+	self->tables[0].count = 0;
+	self->tables[1].count = 0;
+	atomic_init(&self->readers[0], 0);
+	atomic_init(&self->readers[1], 0);
+	atomic_init(&self->published, 0);
+	atomic_flag_clear(&self->writer_lock);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// changes (copy-on-write)
+
+// waits a bit longer on each call: spins first, then yields, so a preempted reader or writer can finish
+static void backoff(unsigned * spins)
+{
+	if(*spins < GPIO_SUBSCRIBER_LIST_SPINS){
+		++*spins;
+	#if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+	#endif
+	} else {
+		sched_yield();
+	}
+}
+
+static void wait_for_readers(gpio_subscriber_list * self, unsigned index)
+{
+	unsigned spins = 0;
+	
+	while(atomic_load(&self->readers[index])){
+		// a dispatch is still reading the table
+		backoff(&spins);
+	}
+}
+
+// locks the list, and returns the unpublished table, with a copy of the published one
+static gpio_subscriber_table * begin_change(gpio_subscriber_list * self)
+{
+	unsigned spins = 0;
+	
+	while(atomic_flag_test_and_set_explicit(&self->writer_lock, memory_order_acquire)){
+		// another change is in progress
+		backoff(&spins);
+	}
+	
+	unsigned published = atomic_load(&self->published);
+	gpio_subscriber_table * table = &self->tables[!published];
+	
+	// a dispatch may have found the table, before it has been unpublished
+	wait_for_readers(self, !published);
+	
+	*table = self->tables[published];
+	return table;
+}
+
+// publishes the table, waits until the old one isn't read anymore, and unlocks the list
+static void end_change(gpio_subscriber_list * self, bool publish)
+{
+	if(publish){
+		unsigned published = atomic_load(&self->published);
+		atomic_store(&self->published, !published);
+		wait_for_readers(self, published);
+	}
+	
+	atomic_flag_clear_explicit(&self->writer_lock, memory_order_release);
+}
+
+bool gpio_subscriber_list_subscribe(gpio_subscriber_list * self, gpio_event_subscription * subscription)
+{
+	gpio_subscriber_table * table = begin_change(self);
+	
+	if(table->count == GPIO_SUBSCRIBER_LIST_CAPACITY){
+		end_change(self, false);
+		return false;
+	}
+	
+	table->subscriptions[table->count++] = subscription;
+	
+	end_change(self, true);
+	return true;
+}
+
+void gpio_subscriber_list_unsubscribe(gpio_subscriber_list * self, gpio_event_subscription * subscription)
+{
+	gpio_subscriber_table * table = begin_change(self);
+	
+	for(size_t i = 0; i < table->count; i++){
+		if(table->subscriptions[i] == subscription){
+			table->subscriptions[i] = table->subscriptions[--table->count];
+			end_change(self, true);
+			return;
+		}
+	}
+	
+	end_change(self, false);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// dispatch (lock-free)
+
+void gpio_subscriber_list_dispatch(gpio_subscriber_list * self, uint32_t changed, uint32_t levels)
+{
+	unsigned index;
+	
+	// register as reader of the published table. If it has been unpublished meanwhile,
+	// a change may be writing into it, so try again.
+	for(;;){
+		index = atomic_load(&self->published);
+		atomic_fetch_add(&self->readers[index], 1);
+		
+		if(atomic_load(&self->published) == index){
+			break;
+		}
+		
+		atomic_fetch_sub(&self->readers[index], 1);
+	}
+	
+	const gpio_subscriber_table * table = &self->tables[index];
+	
+	for(size_t i = 0; i < table->count; i++){
+		gpio_event_subscription * subscription = table->subscriptions[i];
+		uint32_t pins = changed & subscription->pin_mask;
+		
+		for(int pin_nr = 0; pins; pin_nr++, pins >>= 1){
+			if(!(pins & 1)){
+				continue;
+			}
+			
+			gpio_edge edge = (levels >> pin_nr) & 1 ? gpio_edge_rising : gpio_edge_falling;
+			if(subscription->edges & edge){
+				subscription->callback(subscription->context, pin_nr, edge);
+			}
+		}
+	}
+	
+	atomic_fetch_sub(&self->readers[index], 1);
+}
@@ -0,0 +1,51 @@
+#ifndef GPIO_SUBSCRIBER_LIST_H_
+#define GPIO_SUBSCRIBER_LIST_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+// The subscribers of a gpio_event_source, used by the classes implementing it.
+//
+// Events are dispatched far more often than subscribers change, so dispatch takes no lock:
+// the list has two tables, dispatch reads the published one. subscribe / unsubscribe copy
+// it into the other table, change the copy and publish it (copy-on-write). They wait until
+// no dispatch reads the old table anymore, so the old table can be reused by the next change,
+// and the subscription can be released after unsubscribe returns.
+//
+// Changes are serialized by a spinlock (yielding after a few spins), they must not be called from within a callback.
+
+#ifndef GPIO_SUBSCRIBER_LIST_CAPACITY
+#	define GPIO_SUBSCRIBER_LIST_CAPACITY	8
+#endif
+
+struct gpio_event_subscription;
+
+typedef struct gpio_subscriber_table {
+	struct gpio_event_subscription * subscriptions[GPIO_SUBSCRIBER_LIST_CAPACITY];
+	size_t count;
+} gpio_subscriber_table;
+
+typedef struct gpio_subscriber_list {
+	gpio_subscriber_table tables[2];
+	
+	// dispatches reading each table
+	atomic_uint readers[2];
+	
+	// the index of the published table
+	atomic_uint published;
+	
+	atomic_flag writer_lock;
+} gpio_subscriber_list;
+
+void gpio_subscriber_list_initialize(gpio_subscriber_list * self);
+
+bool gpio_subscriber_list_subscribe(gpio_subscriber_list * self, struct gpio_event_subscription * subscription);
+void gpio_subscriber_list_unsubscribe(gpio_subscriber_list * self, struct gpio_event_subscription * subscription);
+
+// calls the subscribers of the pins in changed, levels are the new levels of the pins
+void gpio_subscriber_list_dispatch(gpio_subscriber_list * self, uint32_t changed, uint32_t levels);
+
+
+#endif /* GPIO_SUBSCRIBER_LIST_H_ */
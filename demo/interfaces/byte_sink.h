@@ -0,0 +1,27 @@
+#ifndef BYTE_SINK_H_
+#define BYTE_SINK_H_
+
+#include <stddef.h>
+
+// A consumer of bytes, which lends it's own memory to the producer.
+// The producer writes directly into the memory of the sink, so no copy is needed:
+//
+//	char * buffer = byte_sink_acquire(&sink, 64);
+//	if(buffer){
+//		size_t length = format_into(buffer, 64);
+//		byte_sink_commit(&sink, length);
+//	}
+#define COBJ_INTERFACE_NAME	byte_sink
+
+#define COBJ_INTERFACE_METHODS	\
+	/* returns memory for at least size bytes, or NULL if the sink is full (or size is too large) */	\
+	COBJ_INTERFACE_METHOD(void *, acquire, size_t, size)	\
+	/* publishes length bytes written to the memory returned by acquire, at most the size acquired */	\
+	COBJ_INTERFACE_METHOD(void, commit, size_t, length)	\
+	/* no more data will be written */	\
+	COBJ_INTERFACE_METHOD(void, close)	\
+
+#include "cobj-interface-generator.h"
+
+
+#endif /* BYTE_SINK_H_ */
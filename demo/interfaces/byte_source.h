@@ -0,0 +1,29 @@
+#ifndef BYTE_SOURCE_H_
+#define BYTE_SOURCE_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// A producer of bytes, which lends it's own memory to the consumer.
+// The consumer reads directly from the memory of the source, so no copy is needed:
+//
+//	size_t length;
+//	const char * data = byte_source_acquire(&source, &length);
+//	if(data){
+//		size_t used = parse(data, length);
+//		byte_source_commit(&source, used);
+//	}
+#define COBJ_INTERFACE_NAME	byte_source
+
+#define COBJ_INTERFACE_METHODS	\
+	/* returns the readable memory and it's length, or NULL if there is no data available */	\
+	COBJ_INTERFACE_METHOD(const void *, acquire, size_t *, length)	\
+	/* releases length bytes of the memory returned by acquire */	\
+	COBJ_INTERFACE_METHOD(void, commit, size_t, length)	\
+	/* true, if the producer has closed the stream, and all data was read */	\
+	COBJ_INTERFACE_METHOD(bool, is_closed)	\
+
+#include "cobj-interface-generator.h"
+
+
+#endif /* BYTE_SOURCE_H_ */
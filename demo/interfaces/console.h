@@ -4,8 +4,16 @@
 
 #include <stdarg.h>
 
+// the base interface needs to be included before the symbols are defined. As base,
+// it has no mt of it's own in the classes implementing console.
+#define COBJ_INTERFACE_INCLUDE_BASE
+#include "writer.h"
+
 #define COBJ_INTERFACE_NAME	console
 
+#define COBJ_INTERFACE_EXTENDS	writer
+#define COBJ_INTERFACE_WITH_DELEGATES
+
 #define COBJ_INTERFACE_METHODS	\
 	COBJ_INTERFACE_METHOD(int, vprintf, const char *, string, va_list, vlist)	\
 	
@@ -0,0 +1,30 @@
+#ifndef EVENT_SOURCE_H_
+#define EVENT_SOURCE_H_
+
+#include <stdint.h>
+
+// the events of a file descriptor, the values are the same as the ones of poll and epoll
+typedef enum event_flags {
+	event_readable = 0x001,
+	event_writable = 0x004,
+	event_error = 0x008,
+	event_hangup = 0x010
+} event_flags;
+
+// called by sources (like timerfd_source) with the count read from their file descriptor
+typedef void (* event_callback)(void * context, uint64_t count);
+
+// A file descriptor, which is waited for by a reactor (see classes/epoll_reactor.h).
+// The reactor calls on_ready, if some of the events of interest (event_flags) are ready.
+// Errors and hangups are always reported, the reactor removes the source after that.
+#define COBJ_INTERFACE_NAME	event_source
+
+#define COBJ_INTERFACE_METHODS	\
+	COBJ_INTERFACE_PURE_METHOD(int, fd)	\
+	COBJ_INTERFACE_METHOD(uint32_t, interest)	\
+	COBJ_INTERFACE_METHOD(void, on_ready, uint32_t, events)	\
+
+#include "cobj-interface-generator.h"
+
+
+#endif /* EVENT_SOURCE_H_ */
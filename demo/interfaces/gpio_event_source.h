@@ -0,0 +1,38 @@
+#ifndef GPIO_EVENT_SOURCE_H_
+#define GPIO_EVENT_SOURCE_H_
+
+#include <stdint.h>
+
+typedef enum gpio_edge {
+	gpio_edge_rising = 1,
+	gpio_edge_falling = 2,
+	gpio_edge_both = 3
+} gpio_edge;
+
+// called for every edge of a subscribed pin
+typedef void (* gpio_event_callback)(void * context, int pin_nr, gpio_edge edge);
+
+// the subscription is owned by the subscriber, and must be valid until unsubscribe returns.
+typedef struct gpio_event_subscription {
+	gpio_event_callback callback;
+	void * context;
+	uint32_t pin_mask;	// bit n subscribes pin n of the source
+	gpio_edge edges;
+} gpio_event_subscription;
+
+// A source of edge-events of up to 32 pins. Instead of polling gpio_pin_get_value,
+// consumers subscribe a callback, which is called only if a level changes.
+//
+// The callbacks are called by the thread raising the events (an interrupt, or the
+// thread polling the pins), they must not call subscribe or unsubscribe.
+#define COBJ_INTERFACE_NAME	gpio_event_source
+
+#define COBJ_INTERFACE_METHODS	\
+	COBJ_INTERFACE_METHOD(bool, subscribe, gpio_event_subscription *, subscription) \
+	COBJ_INTERFACE_METHOD(void, unsubscribe, gpio_event_subscription *, subscription) \
+	
+#include "cobj-interface-generator.h"
+
+
+
+#endif /* GPIO_EVENT_SOURCE_H_ */
@@ -10,11 +10,18 @@ typedef enum gpio_pin_options {
 
 #define COBJ_INTERFACE_NAME	gpio_pin
 
+// the decorators generated for gpio_pin (see interface_remote.c, interface_memo.c, ...)
+#define COBJ_INTERFACE_WITH_REMOTE
+#define COBJ_INTERFACE_WITH_RECORD
+#define COBJ_INTERFACE_WITH_MEMO
+#define COBJ_INTERFACE_WITH_CMDBUF
+#define COBJ_INTERFACE_WITH_SYNCHRONIZED
+
 #define COBJ_INTERFACE_METHODS	\
-	COBJ_INTERFACE_METHOD(bool, get_value) \
-	COBJ_INTERFACE_METHOD(void, set_value, bool, value)	\
-	COBJ_INTERFACE_METHOD(void, set_options, gpio_pin_options, options) \
-	COBJ_INTERFACE_METHOD(void, toggle)	\
+	COBJ_INTERFACE_PURE_METHOD(bool, get_value) \
+	COBJ_INTERFACE_SETTER_METHOD(void, set_value, bool, value)	\
+	COBJ_INTERFACE_SETTER_METHOD(void, set_options, gpio_pin_options, options) \
+	COBJ_INTERFACE_MUTATING_METHOD(void, toggle)	\
 	
 #include "cobj-interface-generator.h"
 
@@ -0,0 +1,4 @@
+// command buffers of the interfaces, to capture calls and execute them as a batch (see cobj-cmdbuf.h).
+#define COBJ_INTERFACE_CMDBUF_MODE
+
+#include "gpio_pin.h"
@@ -0,0 +1,5 @@
+// memos of the interfaces, caching the results of pure methods (see COBJ_INTERFACE_PURE_METHOD).
+// A memo is wired in place of a reference, where the pure methods are called often, but are slow.
+#define COBJ_INTERFACE_MEMO_MODE
+
+#include "gpio_pin.h"
@@ -0,0 +1,5 @@
+// recorders and replays of the interfaces, to benchmark classes with recorded calls (see cobj-record.h).
+// Only interfaces passing their arguments by value can be replayed, pointers are not valid anymore.
+#define COBJ_INTERFACE_RECORD_MODE
+
+#include "gpio_pin.h"
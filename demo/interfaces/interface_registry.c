@@ -1,5 +1,12 @@
 
 #define COBJ_INTERFACE_REGISTRY_MODE
 
+#include "writer.h"
 #include "console.h"
 #include "gpio_pin.h"
+#include "gpio_event_source.h"
+#include "byte_sink.h"
+#include "byte_source.h"
+#include "pipeline_stage.h"
+#include "event_source.h"
+#include "scheduler.h"
@@ -0,0 +1,6 @@
+// proxies and stubs of the interfaces called from other processes (see cobj-remote.h).
+// Only interfaces passing their arguments by value are useful here, pointers are not valid
+// in the other process (and va_list can't be copied at all).
+#define COBJ_INTERFACE_REMOTE_MODE
+
+#include "gpio_pin.h"
@@ -0,0 +1,4 @@
+// synchronized decorators of the interfaces, for objects shared by threads (see cobj-synchronized.h).
+#define COBJ_INTERFACE_SYNCHRONIZED_MODE
+
+#include "gpio_pin.h"
@@ -0,0 +1,27 @@
+#ifndef PIPELINE_STAGE_H_
+#define PIPELINE_STAGE_H_
+
+#include "byte_source.h"
+#include "byte_sink.h"
+
+typedef enum pipeline_stage_status {
+	pipeline_stage_progress,	// some data has been processed
+	pipeline_stage_idle,		// no data available, or output full
+	pipeline_stage_done		// finished, the output is closed by the pipeline
+} pipeline_stage_status;
+
+// A stage of a pipeline (see pipeline/pipeline.h). process is called again and again, it
+// processes the data available in input, and writes into output. The first stage has no
+// input, the last stage has no output (NULL).
+//
+// byte_source.h and byte_sink.h are needed for the arguments only, so a class implementing
+// pipeline_stage includes them before defining COBJ_INTERFACE_IMPLEMENTATION_MODE.
+#define COBJ_INTERFACE_NAME	pipeline_stage
+
+#define COBJ_INTERFACE_METHODS	\
+	COBJ_INTERFACE_METHOD(pipeline_stage_status, process, const byte_source *, input, const byte_sink *, output)	\
+
+#include "cobj-interface-generator.h"
+
+
+#endif /* PIPELINE_STAGE_H_ */
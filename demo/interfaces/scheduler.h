@@ -0,0 +1,27 @@
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// identifies a scheduled timer, 0 is never used
+typedef uint64_t scheduler_timer;
+
+// called when the timer expires
+typedef void (* scheduler_callback)(void * context);
+
+// Calls functions at a time, or periodically. The time is counted in ticks of the scheduler,
+// it's defined by the implementation (like timing_wheel). A time in the past expires with the
+// next tick. cancel returns false, if the timer has expired already (and isn't periodic).
+#define COBJ_INTERFACE_NAME	scheduler
+
+#define COBJ_INTERFACE_METHODS	\
+	COBJ_INTERFACE_METHOD(scheduler_timer, schedule_at, uint64_t, time, scheduler_callback, callback, void *, context)	\
+	COBJ_INTERFACE_METHOD(scheduler_timer, schedule_every, uint64_t, interval, scheduler_callback, callback, void *, context)	\
+	COBJ_INTERFACE_METHOD(bool, cancel, scheduler_timer, timer)	\
+	COBJ_INTERFACE_METHOD(uint64_t, now)	\
+
+#include "cobj-interface-generator.h"
+
+
+#endif /* SCHEDULER_H_ */
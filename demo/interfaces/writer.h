@@ -0,0 +1,21 @@
+
+#ifndef WRITER_H_
+#define WRITER_H_
+
+#include <stddef.h>
+
+#define COBJ_INTERFACE_NAME	writer
+#define COBJ_INTERFACE_WITH_DELEGATES
+
+// writer may be extended by other interfaces, so the methods are defined
+// by the writer_methods x-macro
+#define writer_methods	\
+	COBJ_INTERFACE_METHOD(size_t, write, const char *, buffer, size_t, length)	\
+
+#define COBJ_INTERFACE_METHODS	\
+	writer_methods
+
+#include "cobj-interface-generator.h"
+
+
+#endif /* WRITER_H_ */
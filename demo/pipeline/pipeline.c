@@ -0,0 +1,169 @@
+#define _GNU_SOURCE
+
+#include "pipeline.h"
+
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+// idle rounds a worker yields, before it starts to sleep
+#define PIPELINE_IDLE_YIELDS		16
+
+// the maximum sleep of an idle worker
+#define PIPELINE_IDLE_SLEEP_MAX_NS	1000000
+
+bool pipeline_initialize(pipeline * self)
+{
+	size_t stride = BYTE_RING_MEMORY_SIZE(self->block_size, self->block_count);
+	
+	if(self->stage_count < 1){
+		return false;
+	}
+	
+	for(size_t i = 0; i < self->stage_count; i++){
+		pipeline_worker * worker = &self->workers[i];
+		
+		worker->pipeline = self;
+		worker->stage = self->stages[i];
+		worker->has_input = false;
+		worker->has_output = false;
+		worker->done = false;
+	}
+	
+	atomic_init(&self->stopped, false);
+	
+	for(size_t i = 0; i + 1 < self->stage_count; i++){
+		byte_ring * ring = &self->rings[i];
+		
+		if(!byte_ring_initialize(ring, (unsigned char *)self->memory + i * stride, self->block_size, self->block_count)){
+			return false;
+		}
+		
+		// the ring is the output of stage i and the input of stage i+1
+		self->workers[i].output = COBJ_AS(byte_sink, byte_ring, ring);
+		self->workers[i].has_output = true;
+		self->workers[i + 1].input = COBJ_AS(byte_source, byte_ring, ring);
+		self->workers[i + 1].has_input = true;
+	}
+	
+	return true;
+}
+
+// processes the stage once, returns the status
+static pipeline_stage_status pipeline_worker_process(pipeline_worker * worker)
+{
+	pipeline_stage_status status = pipeline_stage_process(&worker->stage,
+		worker->has_input ? &worker->input : NULL,
+		worker->has_output ? &worker->output : NULL);
+	
+	if(status == pipeline_stage_done){
+		worker->done = true;
+		
+		// the next stage sees the end of the stream, after reading all data
+		if(worker->has_output){
+			byte_sink_close(&worker->output);
+		}
+	}
+	
+	return status;
+}
+
+void pipeline_run(pipeline * self)
+{
+	size_t running = self->stage_count;
+	
+	while(running){
+		running = 0;
+		
+		for(size_t i = 0; i < self->stage_count; i++){
+			if(!self->workers[i].done){
+				pipeline_worker_process(&self->workers[i]);
+				running += !self->workers[i].done;
+			}
+		}
+	}
+}
+
+// backs off while the other stages need to make progress first: yields at first,
+//	then sleeps with a doubling time, so idle stages don't burn their cores
+static void pipeline_worker_idle(unsigned int idle_rounds)
+{
+	if(idle_rounds < PIPELINE_IDLE_YIELDS){
+		sched_yield();
+		return;
+	}
+	
+	unsigned int shift = idle_rounds - PIPELINE_IDLE_YIELDS;
+	long sleep_ns = shift < 10 ? 1000L << shift : PIPELINE_IDLE_SLEEP_MAX_NS;
+	
+	struct timespec sleep_time = { .tv_nsec = sleep_ns < PIPELINE_IDLE_SLEEP_MAX_NS ? sleep_ns : PIPELINE_IDLE_SLEEP_MAX_NS };
+	nanosleep(&sleep_time, NULL);
+}
+
+static void * pipeline_worker_thread(void * argument)
+{
+	pipeline_worker * worker = argument;
+	unsigned int idle_rounds = 0;
+	
+	while(!atomic_load_explicit(&worker->pipeline->stopped, memory_order_relaxed)){
+		switch(pipeline_worker_process(worker)){
+		case pipeline_stage_progress:
+			idle_rounds = 0;
+			break;
+		case pipeline_stage_idle:
+			pipeline_worker_idle(idle_rounds);
+			idle_rounds += idle_rounds < PIPELINE_IDLE_YIELDS + 10;
+			break;
+		case pipeline_stage_done:
+			return NULL;
+		}
+	}
+	
+	return NULL;
+}
+
+bool pipeline_start(pipeline * self)
+{
+#ifdef __linux__
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+	
+	if(cores < 1){
+		cores = 1;
+	}
+#endif
+	
+	for(size_t i = 0; i < self->stage_count; i++){
+		pipeline_worker * worker = &self->workers[i];
+		
+		if(pthread_create(&worker->thread, NULL, &pipeline_worker_thread, worker)){
+			// the stages can't run without each other, so stop the started ones
+			atomic_store_explicit(&self->stopped, true, memory_order_relaxed);
+			
+			for(size_t j = 0; j < i; j++){
+				pthread_join(self->workers[j].thread, NULL);
+			}
+			
+			return false;
+		}
+		
+	#ifdef __linux__
+		if(self->pin_to_cores){
+			cpu_set_t cpus;
+			CPU_ZERO(&cpus);
+			CPU_SET((i % (size_t)cores) % CPU_SETSIZE, &cpus);
+			
+			// pinning is an optimization only, so a failure is ignored
+			pthread_setaffinity_np(worker->thread, sizeof(cpus), &cpus);
+		}
+	#endif
+	}
+	
+	return true;
+}
+
+void pipeline_join(pipeline * self)
+{
+	for(size_t i = 0; i < self->stage_count; i++){
+		pthread_join(self->workers[i].thread, NULL);
+	}
+}
@@ -0,0 +1,79 @@
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "interfaces/pipeline_stage.h"
+#include "classes/byte_ring.h"
+
+// A pipeline links stages, each stage writes directly into the ring read by the next stage:
+//
+//	stage[0] -> ring[0] -> stage[1] -> ring[1] -> stage[2]
+//
+// The pipeline can run on the calling thread (pipeline_run), or each stage on it's own
+// thread (pipeline_start / pipeline_join), optionally pinned to a core.
+//
+// All arrays are provided by the user:
+//
+//	static pipeline_worker workers[3];
+//	static byte_ring rings[2];
+//	static max_align_t memory[2 * BYTE_RING_MEMORY_SIZE(512, 8) / sizeof(max_align_t)];
+//
+//	pipeline p = {
+//		.stages = stages, .workers = workers, .stage_count = 3,
+//		.rings = rings, .memory = memory, .block_size = 512, .block_count = 8,
+//	};
+//	pipeline_initialize(&p);
+
+typedef struct pipeline pipeline;
+
+typedef struct pipeline_worker {
+	pipeline * pipeline;
+	pipeline_stage stage;
+	
+	byte_source input;
+	byte_sink output;
+	bool has_input;
+	bool has_output;
+	bool done;
+	
+	pthread_t thread;
+} pipeline_worker;
+
+struct pipeline {
+	// stage_count stages, and a worker for each
+	const pipeline_stage * stages;
+	pipeline_worker * workers;
+	size_t stage_count;
+	
+	// stage_count - 1 rings, with PIPELINE_MEMORY_SIZE bytes of memory
+	byte_ring * rings;
+	void * memory;
+	size_t block_size;
+	size_t block_count;
+	
+	// pipeline_start pins stage i to core i % cores
+	bool pin_to_cores;
+	
+	// set if pipeline_start failed, the started workers return
+	atomic_bool stopped;
+};
+
+#define PIPELINE_MEMORY_SIZE(stage_count, block_size, block_count)	\
+	(((stage_count) - 1) * BYTE_RING_MEMORY_SIZE(block_size, block_count))
+
+// initializes the rings, and links them to the stages
+bool pipeline_initialize(pipeline * self);
+
+// runs all stages round-robin on the calling thread, until all are done
+void pipeline_run(pipeline * self);
+
+// runs each stage on it's own thread. Idle stages back off, up to a sleep of 1ms.
+//	If a thread can't be created, the started ones are stopped and joined, and false is returned.
+bool pipeline_start(pipeline * self);
+void pipeline_join(pipeline * self);
+
+
+#endif /* PIPELINE_H_ */
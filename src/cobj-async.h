@@ -0,0 +1,129 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef COBJ_ASYNC_H_
+#define COBJ_ASYNC_H_
+
+//////////////////////////////////////////////////////////////////////////
+// stackless coroutines for COBJ_INTERFACE_ASYNC_METHOD
+//
+//	An async method is implemented by a METHOD_poll_impl function, which is called
+//	again and again until it returns COBJ_ASYNC_DONE. The state of the call is kept in
+//	the frame (the point to resume), so no stack or thread is needed while waiting:
+//
+//	static cobj_async_status gpio_pin_wait_poll_impl(hw_gpio_pin_impl * self, gpio_pin_wait_frame * frame)
+//	{
+//		COBJ_ASYNC_BEGIN(frame);
+//		
+//		COBJ_ASYNC_AWAIT(frame, read_pin(self) == frame->value);
+//		frame->result = true;
+//		
+//		COBJ_ASYNC_END(frame);
+//	}
+//
+//	Local variables are lost when the method returns COBJ_ASYNC_PENDING. Variables needed
+//	after an await are kept in the frame: if the interface defines COBJ_INTERFACE_ASYNC_LOCALS
+//	with the number of bytes, each frame has a locals buffer. Use COBJ_ASYNC_LOCALS before COBJ_ASYNC_BEGIN,
+//	because no declarations may be jumped over:
+//
+//		COBJ_ASYNC_LOCALS(frame, struct { int retries; }, locals);
+//		COBJ_ASYNC_BEGIN(frame);
+//		...
+//
+//	switch is used to resume, so COBJ_ASYNC_YIELD / COBJ_ASYNC_AWAIT can't be used
+//	within an own switch statement.
+
+typedef unsigned int cobj_async_state;
+
+typedef enum {
+	COBJ_ASYNC_PENDING,
+	COBJ_ASYNC_DONE
+} cobj_async_status;
+
+// the state of a started frame, and of a finished one
+#define COBJ_ASYNC_STATE_INIT		0
+#define COBJ_ASYNC_STATE_DONE		((cobj_async_state)-1)
+
+// the state to resume at, unique within the translation unit. Without __COUNTER__
+//	the line is used, so only one yield / await per line is allowed.
+#ifdef __COUNTER__
+#	define COBJPVT_ASYNC_RESUME_STATE	(__COUNTER__ + 1)
+#else
+#	define COBJPVT_ASYNC_RESUME_STATE	__LINE__
+#endif
+
+#define COBJ_ASYNC_BEGIN(frame)	\
+	switch((frame)->state) {	\
+		case COBJ_ASYNC_STATE_INIT:
+
+// returns COBJ_ASYNC_PENDING, and continues here on the next poll
+#define COBJ_ASYNC_YIELD(frame)	\
+	COBJPVT_ASYNC_YIELD(frame, COBJPVT_ASYNC_RESUME_STATE)
+
+#define COBJPVT_ASYNC_YIELD(frame, state_)	\
+	do {	\
+		(frame)->state = state_;	\
+		return COBJ_ASYNC_PENDING;	\
+		case state_:;	\
+	} while(0)
+
+// returns COBJ_ASYNC_PENDING until condition is true
+#define COBJ_ASYNC_AWAIT(frame, condition)	\
+	COBJPVT_ASYNC_AWAIT(frame, condition, COBJPVT_ASYNC_RESUME_STATE)
+
+#define COBJPVT_ASYNC_AWAIT(frame, condition, state_)	\
+	do {	\
+		(frame)->state = state_;	\
+		if(0) {	\
+		case state_:;	\
+		}	\
+		if(!(condition)) {	\
+			return COBJ_ASYNC_PENDING;	\
+		}	\
+	} while(0)
+
+// awaits another async call, started before with INTERFACE_METHOD_start
+#define COBJ_ASYNC_AWAIT_POLL(frame, poll)	\
+	COBJ_ASYNC_AWAIT(frame, (poll) == COBJ_ASYNC_DONE)
+
+// finishes the call early
+#define COBJ_ASYNC_EXIT(frame)	\
+	do {	\
+		(frame)->state = COBJ_ASYNC_STATE_DONE;	\
+		return COBJ_ASYNC_DONE;	\
+	} while(0)
+
+#define COBJ_ASYNC_END(frame)	\
+		default:;	\
+	}	\
+	(frame)->state = COBJ_ASYNC_STATE_DONE;	\
+	return COBJ_ASYNC_DONE
+
+#define COBJ_ASYNC_LOCALS(frame, GEN_TYPE, GEN_NAME)	\
+	COBJPVT_ASSERT(sizeof(GEN_TYPE) <= sizeof((frame)->locals), "COBJ_INTERFACE_ASYNC_LOCALS of the interface is too small");	\
+	GEN_TYPE * GEN_NAME = (void *)(frame)->locals.bytes
+
+#endif /* COBJ_ASYNC_H_ */
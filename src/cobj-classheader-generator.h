@@ -43,54 +43,237 @@ SOFTWARE.
 #	error "cobj-classheader-generator.h was included without defining COBJ_CLASS_INTERFACES"
 #endif
 
-//////////////////////////////////////////////////////////////////////////
-// (1) strong typed implemenation object_struct
-#ifndef COBJ_IMPLEMENTATION_FILE
-	// if we are in an implementation-file, this struct has already been rendered
-	// on the first interface-implementation, because the thunks need the type
-	// to be defined already.
-	typedef struct {
-		cobj_class_descriptor * class_desriptor;
-		#define COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
-			GEN_VARIABLE_TYPE GEN_VARIABLE_NAME;
-		COBJPVT_GEN_CLASS_VARIABLE_GENERATOR()
-		#undef COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE	
-	} genclass_object_impl;
+//	COBJ_CLASS_LAZY: the proxy contains the object, so it can't be released by a reference count
+#if defined(COBJ_CLASS_LAZY) && defined(COBJ_CLASS_REFCOUNTED)
+#	error "COBJ_CLASS_LAZY can't be combined with COBJ_CLASS_REFCOUNTED"
 #endif
 
+//////////////////////////////////////////////////////////////////////////
+// (1) cold variables and strong typed implemenation object_struct
+//	if we are in an implementation-file, this has already been rendered
+//	on the first interface-implementation, because the thunks need the type
+//	to be defined already.
+#include "cobjpvt-generator-class-layout.h"
+
 //////////////////////////////////////////////////////////////////////////
 // (2) public object struct
 typedef union {
 	struct {
-		const cobj_class_descriptor * class_desriptor;
-		struct {
-			#define COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
-				struct { GEN_VARIABLE_TYPE _; };
-			COBJPVT_GEN_CLASS_VARIABLE_GENERATOR()
-			#undef COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE	
-		} class_data;
+		COBJPVT_GEN_CLASS_ALIGNAS const cobj_class_descriptor * class_desriptor;
+		#ifdef COBJ_CLASS_REFCOUNTED
+			cobj_refcount refcount;
+		#endif
+		// the variables are members of the same struct as in the _impl struct, so the layout
+		// is the same, even if a variable has a larger alignment than the class_descriptor
+		#define COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
+			GEN_VARIABLE_TYPE GEN_VARIABLE_NAME;
+		#define COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)
+		COBJPVT_GEN_CLASS_VARIABLE_GENERATOR()
+		#undef COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE
+		#undef COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE
+		#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+			genclass_cold * cold;
+		#endif
 	} private_data;
 	
 	cobj_object object;
 	
 } genclass_object;
 
+//////////////////////////////////////////////////////////////////////////
+// (2.1) layout report, may be pinned by COBJ_CLASS_ASSERT_LAYOUT
+enum {
+	// sizeof the object, including padding
+	COBJ_PP_CONCAT(genclass, _layout_size) = sizeof(genclass_object),
+	
+	// the bytes used by the class_descriptor, the refcount, the hot variables, and the link to the cold variables
+	COBJ_PP_CONCAT(genclass, _layout_hot_size) = sizeof(const cobj_class_descriptor *)
+		#ifdef COBJ_CLASS_REFCOUNTED
+			+ sizeof(cobj_refcount)
+		#endif
+		#define COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
+			+ sizeof(GEN_VARIABLE_TYPE)
+		#define COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)
+		COBJPVT_GEN_CLASS_VARIABLE_GENERATOR()
+		#undef COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE
+		#undef COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE
+		#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+			+ sizeof(genclass_cold *)
+		#endif
+		,
+	
+	// the bytes lost by padding and alignment
+	COBJ_PP_CONCAT(genclass, _layout_padding) = COBJ_PP_CONCAT(genclass, _layout_hot_size) < sizeof(genclass_object)
+		? sizeof(genclass_object) - COBJ_PP_CONCAT(genclass, _layout_hot_size) : 0,
+	
+	// sizeof the cold variables, not part of the object
+	#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+		COBJ_PP_CONCAT(genclass, _layout_cold_size) = sizeof(genclass_cold),
+	#else
+		COBJ_PP_CONCAT(genclass, _layout_cold_size) = 0,
+	#endif
+};
+
+COBJPVT_EXTERN_C_BEGIN
 
 //////////////////////////////////////////////////////////////////////////
 // (3) descriptor
 extern const cobj_class_descriptor * const genclass_descriptor;
 
+// the instance itself is only needed for constant initializers (COBJ_STATIC_OBJECT)
+extern const cobj_class_descriptor genclass_descriptor_instance;
+
+//////////////////////////////////////////////////////////////////////////
+// (3.1) method-tables of the implemented interfaces, needed for constant references (COBJ_STATIC_REFERENCE)
+#define COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE(GEN_INTERFACE_NAME)	\
+	extern const COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _mt) COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, GEN_INTERFACE_NAME, _mt);
+
+	COBJPVT_GEN_CLASS_INTERFACE_GENERATOR()
+#undef COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE
+
+//////////////////////////////////////////////////////////////////////////
+// (3.2) references to the implemented interfaces, like hw_gpio_pin_as_gpio_pin(&pin)
+//	The class is known, so no queryinterface is needed: the mt is a link-time constant.
+#define COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE(GEN_INTERFACE_NAME)	\
+	static inline GEN_INTERFACE_NAME COBJ_PP_CONCAT(COBJ_CLASS_NAME, _as_, GEN_INTERFACE_NAME)(genclass_object * self) {	\
+		GEN_INTERFACE_NAME reference;	\
+		reference.mt = (COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _mt) *)&COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, GEN_INTERFACE_NAME, _mt);	\
+		reference.object = &self->object;	\
+		return reference;	\
+	}
+
+	COBJPVT_GEN_CLASS_INTERFACE_GENERATOR()
+	
+	/*
+		Common Error:
+		'class_interface_mt' undeclared (with COBJ_AS), or implicit declaration of function 'class_as_interface'
+
+		Cause:
+		The class doesn't implement the interface, it's not part of COBJ_CLASS_INTERFACES.
+
+		Resolution:
+		Use an interface implemented by the class, or query the interface at runtime with interface_queryinterface.
+	*/
+#undef COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE
+
 //////////////////////////////////////////////////////////////////////////
 // (4) init-function
 #ifdef COBJ_CLASS_PARAMETERS
 
 	bool genclass_initialize(
 		genclass_object * self
+		#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+			,genclass_cold * cold
+		#endif
+		#define COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE(GEN_PARAM_TYPE, GEN_PARAM_NAME)	\
+			,GEN_PARAM_TYPE GEN_PARAM_NAME
+		COBJPVT_GEN_CLASS_PARAMETER_GENERATOR()
+		#undef COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE
+	);
+
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// (4.1) the parameters of the initializer as struct, for the generic initializer of the descriptor
+#define COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE(GEN_PARAM_TYPE, GEN_PARAM_NAME)	\
+	+1
+#if (0 COBJPVT_GEN_CLASS_PARAMETER_GENERATOR()) > 0
+#	define COBJPVT_GEN_CLASS_HAS_PARAMETERS
+#endif
+#undef COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE
+
+#ifdef COBJPVT_GEN_CLASS_HAS_PARAMETERS
+	typedef struct {
+		#define COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE(GEN_PARAM_TYPE, GEN_PARAM_NAME)	\
+			GEN_PARAM_TYPE GEN_PARAM_NAME;
+		COBJPVT_GEN_CLASS_PARAMETER_GENERATOR()
+		#undef COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE
+	} genclass_parameters;
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// (4.2) proxy of COBJ_CLASS_LAZY: the initializer stores the parameters only, the object
+//	is initialized by the first method called on the proxy (see cobj-lazy.h)
+#ifdef COBJ_CLASS_LAZY
+
+	typedef union {
+		struct {
+			const cobj_class_descriptor * class_desriptor;
+			cobj_lazy lazy;
+			
+			// the object (genclass_object), as bytes because the object has a flexible array member
+			_Alignas(genclass_object) unsigned char target[sizeof(genclass_object)];
+			
+			#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+				genclass_cold * cold;
+			#endif
+			#ifdef COBJPVT_GEN_CLASS_HAS_PARAMETERS
+				genclass_parameters parameters;
+			#endif
+		} private_data;
+		
+		cobj_object object;
+		
+	} genclass_lazy;
+	
+	extern const cobj_class_descriptor * const genclass_lazy_descriptor;
+	extern const cobj_class_descriptor genclass_lazy_descriptor_instance;
+	
+	bool genclass_lazy_initialize(
+		genclass_lazy * self
+		#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+			,genclass_cold * cold
+		#endif
 		#define COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE(GEN_PARAM_TYPE, GEN_PARAM_NAME)	\
 			,GEN_PARAM_TYPE GEN_PARAM_NAME
 		COBJPVT_GEN_CLASS_PARAMETER_GENERATOR()
 		#undef COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE
 	);
+	
+	// initializes the object now, if it's not initialized yet. Returns the result of the initializer,
+	//	which is called once, so after it failed, false is returned without calling it again.
+	bool genclass_lazy_resolve(genclass_lazy * self);
+	
+	// the method-tables and references of the proxy, like hw_gpio_pin_lazy_as_gpio_pin(&pin)
+	#define COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE(GEN_INTERFACE_NAME)	\
+		extern const COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _mt) COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, GEN_INTERFACE_NAME, _lazy_mt);	\
+		\
+		static inline GEN_INTERFACE_NAME COBJ_PP_CONCAT(COBJ_CLASS_NAME, _lazy_as_, GEN_INTERFACE_NAME)(genclass_lazy * self) {	\
+			GEN_INTERFACE_NAME reference;	\
+			reference.mt = (COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _mt) *)&COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, GEN_INTERFACE_NAME, _lazy_mt);	\
+			reference.object = &self->object;	\
+			return reference;	\
+		}
+		
+		COBJPVT_GEN_CLASS_INTERFACE_GENERATOR()
+	#undef COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE
+
+#endif
+
+COBJPVT_EXTERN_C_END
+
+//////////////////////////////////////////////////////////////////////////
+// (5) C++ layer (see cobj.hpp)
+#if defined(__cplusplus) && __cplusplus >= 202002L
+
+	#include "cobj.hpp"
+	
+	namespace cobj {
+		
+		template<> struct class_traits<genclass_object> {
+			static constexpr const char * name = COBJPVT_PP_STRINGIFY(COBJ_CLASS_NAME);
+			static constexpr const cobj_class_descriptor * descriptor = &genclass_descriptor_instance;
+		};
+		
+		// the method-tables of the implemented interfaces, for the static dispatch of cobj::ref<interface, class>
+		#define COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE(GEN_INTERFACE_NAME)	\
+			template<> struct implementation<genclass_object, GEN_INTERFACE_NAME> {	\
+				static constexpr const COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _mt) * mt = &COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, GEN_INTERFACE_NAME, _mt);	\
+			};
+			
+			COBJPVT_GEN_CLASS_INTERFACE_GENERATOR()
+		#undef COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE
+	}
 
 #endif
 
@@ -99,6 +282,11 @@ extern const cobj_class_descriptor * const genclass_descriptor;
 //	This will implement the functions and variables
 #ifdef COBJ_IMPLEMENTATION_FILE
 
+	//////////////////////////////////////////////////////////////////////////
+	// (0) the public object struct must have the same layout as the _impl struct
+	COBJPVT_ASSERT(sizeof(genclass_object) == sizeof(genclass_object_impl), "layout of the public object differs from the _impl object");
+	COBJPVT_ASSERT(_Alignof(genclass_object) == _Alignof(genclass_object_impl), "alignment of the public object differs from the _impl object");
+
 	//////////////////////////////////////////////////////////////////////////
 	// (1) fw-declare the initializer_impl
 	static bool initialize_impl(
@@ -113,6 +301,9 @@ extern const cobj_class_descriptor * const genclass_descriptor;
 	// (2) implement the public initializer
 	bool genclass_initialize(
 		genclass_object * self
+		#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+			,genclass_cold * cold
+		#endif
 		#define COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE(GEN_PARAM_TYPE, GEN_PARAM_NAME)	\
 			,GEN_PARAM_TYPE GEN_PARAM_NAME
 		COBJPVT_GEN_CLASS_PARAMETER_GENERATOR()
@@ -121,6 +312,14 @@ extern const cobj_class_descriptor * const genclass_descriptor;
 		
 		self->private_data.class_desriptor = genclass_descriptor;
 		
+		#ifdef COBJ_CLASS_REFCOUNTED
+			cobj_refcount_initialize(&self->private_data.refcount);
+		#endif
+		
+		#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+			self->private_data.cold = cold;
+		#endif
+		
 		return initialize_impl(
 		(genclass_object_impl*)self
 		#define COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE(GEN_PARAM_TYPE, GEN_PARAM_NAME)	\
@@ -131,37 +330,238 @@ extern const cobj_class_descriptor * const genclass_descriptor;
 	}
 	
 	
+	//////////////////////////////////////////////////////////////////////////
+	// (2.1) the generic initializer, called by the descriptor
+	static bool genclass_initialize_generic(cobj_object * object, void * cold, const void * parameters){
+		
+		// unused, if the class has no cold variables or no parameters
+		(void)cold;
+		(void)parameters;
+		
+		#ifdef COBJPVT_GEN_CLASS_HAS_PARAMETERS
+			const genclass_parameters * arguments = (const genclass_parameters *)parameters;
+		#endif
+		
+		return genclass_initialize(
+			(genclass_object*)object
+			#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+				,(genclass_cold *)cold
+			#endif
+			#define COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE(GEN_PARAM_TYPE, GEN_PARAM_NAME)	\
+				,arguments->GEN_PARAM_NAME
+			COBJPVT_GEN_CLASS_PARAMETER_GENERATOR()
+			#undef COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE
+		);
+	}
+	
 	//////////////////////////////////////////////////////////////////////////
 	// (3) declare and implement queryinterface
 	static cobj_mt queryinterface(const cobj_interface_descriptor * interface);
 	static cobj_mt queryinterface(const cobj_interface_descriptor * interface){
 				
+		// the interface may have been compiled with more methods than the class (for example in a plugin,
+		// see cobj-plugin.h), then the mt of the class is too short
+		#define COBJPVT_GEN_CLASS_INTERFACE_COMPATIBLE(GEN_INTERFACE_NAME)	\
+			(COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _descriptor)->methods_count <= sizeof(COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _mt)) / sizeof(void (*)(void)))
+		
 		#define COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE(GEN_INTERFACE_NAME)	\
-			if(interface == COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _descriptor)) \
+			if(interface == COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _descriptor) && COBJPVT_GEN_CLASS_INTERFACE_COMPATIBLE(GEN_INTERFACE_NAME)) \
 				return (cobj_mt)(&COBJ_PP_CONCAT(COBJ_CLASS_NAME, _ , GEN_INTERFACE_NAME, _mt));
 			
 			COBJPVT_GEN_CLASS_INTERFACE_GENERATOR()
 		#undef COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE
 		
+		// base interfaces of the implemented interfaces (COBJ_INTERFACE_EXTENDS) use the same mt
+		#define COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE(GEN_INTERFACE_NAME)	\
+			if(cobj_interface_is_compatible(COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _descriptor), interface) && COBJPVT_GEN_CLASS_INTERFACE_COMPATIBLE(GEN_INTERFACE_NAME)) \
+				return (cobj_mt)(&COBJ_PP_CONCAT(COBJ_CLASS_NAME, _ , GEN_INTERFACE_NAME, _mt));
+			
+			COBJPVT_GEN_CLASS_INTERFACE_GENERATOR()
+		#undef COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE
+		
+		#undef COBJPVT_GEN_CLASS_INTERFACE_COMPATIBLE
+		
 		return (cobj_mt*)0;
 	}
 	
+	//////////////////////////////////////////////////////////////////////////
+	// (3.1) declare finalize_impl, and the finalize hook calling it
+	#ifdef COBJ_CLASS_REFCOUNTED
+		static void finalize_impl(genclass_object_impl * self);
+		
+		static void genclass_finalize(cobj_object * object){
+			finalize_impl((genclass_object_impl*)object);
+		}
+		
+		/*
+			Common Error:
+			'finalize_impl' used but never defined
+
+			Cause:
+			The class defines COBJ_CLASS_REFCOUNTED, but doesn't implement finalize_impl.
+
+			Resolution:
+			Implement it, it's called when the last reference is released:
+			static void finalize_impl(CLASS_NAME_impl * self)
+			{
+				...
+			}
+		*/
+	#endif
+	
 	//////////////////////////////////////////////////////////////////////////
 	// (4) generate the class-descriptor
-	static const cobj_class_descriptor genclass_descriptor_instance = {
+	const cobj_class_descriptor genclass_descriptor_instance = {
 		.class_name = COBJPVT_PP_STRINGIFY(COBJ_CLASS_NAME),
-		.queryinterface = &queryinterface		
+		.queryinterface = &queryinterface,
+	#ifdef COBJ_CLASS_REFCOUNTED
+		.finalize = &genclass_finalize,
+	#endif
+		.object_size = sizeof(genclass_object),
+		.object_alignment = _Alignof(genclass_object),
+	#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+		.cold_size = sizeof(genclass_cold),
+	#endif
+		.initialize = &genclass_initialize_generic,
 	};
 	
 	const cobj_class_descriptor * const genclass_descriptor = &genclass_descriptor_instance;	
 
+	//////////////////////////////////////////////////////////////////////////
+	// (5) implement the proxy of COBJ_CLASS_LAZY, the thunks are generated with the thunks of the class
+	#ifdef COBJ_CLASS_LAZY
+	
+		COBJPVT_ASSERT(offsetof(genclass_lazy, private_data.target) == offsetof(genclass_lazy_impl, target), "layout of the public proxy differs from the _impl proxy");
+		
+		bool genclass_lazy_initialize(
+			genclass_lazy * self
+			#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+				,genclass_cold * cold
+			#endif
+			#define COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE(GEN_PARAM_TYPE, GEN_PARAM_NAME)	\
+				,GEN_PARAM_TYPE GEN_PARAM_NAME
+			COBJPVT_GEN_CLASS_PARAMETER_GENERATOR()
+			#undef COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE
+		) {
+			
+			self->private_data.class_desriptor = genclass_lazy_descriptor;
+			cobj_lazy_initialize(&self->private_data.lazy);
+			
+			#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+				self->private_data.cold = cold;
+			#endif
+			
+			#define COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE(GEN_PARAM_TYPE, GEN_PARAM_NAME)	\
+				self->private_data.parameters.GEN_PARAM_NAME = GEN_PARAM_NAME;
+			COBJPVT_GEN_CLASS_PARAMETER_GENERATOR()
+			#undef COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE
+			
+			return true;
+		}
+		
+		bool genclass_lazy_resolve(genclass_lazy * self){
+			return cobj_lazy_resolve(&self->private_data.lazy, genclass_descriptor, (cobj_object *)self->private_data.target,
+			#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+				self->private_data.cold,
+			#else
+				(void *)0,
+			#endif
+			#ifdef COBJPVT_GEN_CLASS_HAS_PARAMETERS
+				&self->private_data.parameters
+			#else
+				(const void *)0
+			#endif
+			);
+		}
+		
+		// the slow path of the thunks. Returns null, if the initializer failed, so the thunks
+		//	don't call the methods of the object, and return zero (check it with CLASS_lazy_resolve).
+		static cobj_object * lazy_resolve_target(genclass_lazy_impl * self){
+			if(!genclass_lazy_resolve((genclass_lazy *)self)){
+				return (cobj_object *)0;
+			}
+			
+			return (cobj_object *)&self->target;
+		}
+		
+		static bool genclass_lazy_initialize_generic(cobj_object * object, void * cold, const void * parameters){
+			
+			(void)cold;
+			(void)parameters;
+			
+			#ifdef COBJPVT_GEN_CLASS_HAS_PARAMETERS
+				const genclass_parameters * arguments = (const genclass_parameters *)parameters;
+			#endif
+			
+			return genclass_lazy_initialize(
+				(genclass_lazy*)object
+				#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+					,(genclass_cold *)cold
+				#endif
+				#define COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE(GEN_PARAM_TYPE, GEN_PARAM_NAME)	\
+					,arguments->GEN_PARAM_NAME
+				COBJPVT_GEN_CLASS_PARAMETER_GENERATOR()
+				#undef COBJPVT_GEN_CLASS_PARAMETER_TEMPLATE
+			);
+		}
+		
+		// the same as queryinterface, with the method-tables of the proxy
+		static cobj_mt lazy_queryinterface(const cobj_interface_descriptor * interface){
+			
+			#define COBJPVT_GEN_CLASS_INTERFACE_COMPATIBLE(GEN_INTERFACE_NAME)	\
+				(COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _descriptor)->methods_count <= sizeof(COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _mt)) / sizeof(void (*)(void)))
+			
+			#define COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE(GEN_INTERFACE_NAME)	\
+				if(interface == COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _descriptor) && COBJPVT_GEN_CLASS_INTERFACE_COMPATIBLE(GEN_INTERFACE_NAME)) \
+					return (cobj_mt)(&COBJ_PP_CONCAT(COBJ_CLASS_NAME, _ , GEN_INTERFACE_NAME, _lazy_mt));
+				
+				COBJPVT_GEN_CLASS_INTERFACE_GENERATOR()
+			#undef COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE
+			
+			#define COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE(GEN_INTERFACE_NAME)	\
+				if(cobj_interface_is_compatible(COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _descriptor), interface) && COBJPVT_GEN_CLASS_INTERFACE_COMPATIBLE(GEN_INTERFACE_NAME)) \
+					return (cobj_mt)(&COBJ_PP_CONCAT(COBJ_CLASS_NAME, _ , GEN_INTERFACE_NAME, _lazy_mt));
+				
+				COBJPVT_GEN_CLASS_INTERFACE_GENERATOR()
+			#undef COBJPVT_GEN_CLASS_INTERFACE_TEMPLATE
+			
+			#undef COBJPVT_GEN_CLASS_INTERFACE_COMPATIBLE
+			
+			return (cobj_mt*)0;
+		}
+		
+		// the proxy has no reference count, only the object
+		const cobj_class_descriptor genclass_lazy_descriptor_instance = {
+			.class_name = COBJPVT_PP_STRINGIFY(COBJ_CLASS_NAME) "_lazy",
+			.queryinterface = &lazy_queryinterface,
+			.object_size = sizeof(genclass_lazy),
+			.object_alignment = _Alignof(genclass_lazy),
+		#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+			.cold_size = sizeof(genclass_cold),
+		#endif
+			.initialize = &genclass_lazy_initialize_generic,
+		};
+		
+		const cobj_class_descriptor * const genclass_lazy_descriptor = &genclass_lazy_descriptor_instance;
+	
+	#endif
+
 
 
 #endif
 
 
+// cleanup the layout of this class
+#undef COBJPVT_GEN_CLASS_LAYOUT_GENERATED
+#undef COBJPVT_GEN_CLASS_HAS_COLD
+#undef COBJPVT_GEN_CLASS_HAS_PARAMETERS
+#undef COBJPVT_GEN_CLASS_ALIGNAS
+
 // #undef properties passed
 #undef COBJ_CLASS_NAME
+#undef COBJ_CLASS_ALIGN
+#undef COBJ_CLASS_REFCOUNTED
+#undef COBJ_CLASS_LAZY
 #undef COBJ_CLASS_PARAMETERS
 #undef COBJ_CLASS_VARIABLES
 #undef COBJ_CLASS_INTERFACES
\ No newline at end of file
@@ -0,0 +1,142 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+#ifndef COBJ_CMDBUF_H_
+#define COBJ_CMDBUF_H_
+
+//////////////////////////////////////////////////////////////////////////
+// command buffers: calls to an interface captured now, and executed as a batch later
+//
+//	The interfaces are generated in COBJ_INTERFACE_CMDBUF_MODE once (like in the interface-registry),
+//	which generates a cmdbuf class for them. It implements the interface by appending the calls
+//	as commands to a preallocated buffer:
+//
+//	static uint64_t memory[256];
+//	gpio_pin_cmdbuf commands;
+//	gpio_pin_cmdbuf_initialize(&commands, memory, sizeof(memory));
+//	gpio_pin_queryinterface(&commands.object, &application_resources.output_pin);
+//	...
+//	gpio_pin_cmdbuf_execute(&commands, &production_pin);
+//	gpio_pin_cmdbuf_reset(&commands);
+//
+//	The commands are executed through the mt of the target, which is loaded once. A setter
+//	(see COBJ_INTERFACE_SETTER_METHOD) called again replaces the last command, if it's the same
+//	method. Pure methods (see COBJ_INTERFACE_PURE_METHOD) are not captured, and methods return a
+//	zero-initialized result. The buffer is used by one thread at a time, so it may be filled by
+//	one thread, and handed over to another one executing it.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "cobj.h"
+
+// the alignment of the commands, and of the memory of the buffer
+#define COBJ_CMDBUF_ALIGNMENT	8
+
+// the first member of each command. The size includes the header, and the padding to the next command.
+typedef struct cobj_cmdbuf_header {
+	uint32_t method;
+	uint32_t size;
+} cobj_cmdbuf_header;
+
+typedef struct cobj_cmdbuf {
+	unsigned char * memory;
+	size_t capacity;
+	size_t size;
+	
+	// the offset of the last command, or SIZE_MAX
+	size_t last;
+	
+	// a command didn't fit into the buffer, it's not executed
+	bool overflow;
+} cobj_cmdbuf;
+
+static inline void cobj_cmdbuf_reset(cobj_cmdbuf * buffer)
+{
+	buffer->size = 0;
+	buffer->last = SIZE_MAX;
+	buffer->overflow = false;
+}
+
+static inline bool cobj_cmdbuf_initialize(cobj_cmdbuf * buffer, void * memory, size_t capacity)
+{
+	if((uintptr_t)memory % COBJ_CMDBUF_ALIGNMENT){
+		return false;
+	}
+	
+	buffer->memory = (unsigned char *)memory;
+	buffer->capacity = capacity;
+	cobj_cmdbuf_reset(buffer);
+	
+	return true;
+}
+
+// appends a command of size bytes (including the header), the caller stores the arguments behind
+// the header. Returns null if the buffer is full.
+static inline cobj_cmdbuf_header * cobj_cmdbuf_append(cobj_cmdbuf * buffer, uint32_t method, size_t size)
+{
+	size = (size + COBJ_CMDBUF_ALIGNMENT - 1) & ~(size_t)(COBJ_CMDBUF_ALIGNMENT - 1);
+	
+	if(size > buffer->capacity - buffer->size){
+		buffer->overflow = true;
+		return (cobj_cmdbuf_header *)0;
+	}
+	
+	cobj_cmdbuf_header * header = (cobj_cmdbuf_header *)(buffer->memory + buffer->size);
+	header->method = method;
+	header->size = (uint32_t)size;
+	
+	buffer->last = buffer->size;
+	buffer->size += size;
+	
+	return header;
+}
+
+// the last command, if it's a call of method, else null
+static inline cobj_cmdbuf_header * cobj_cmdbuf_last(cobj_cmdbuf * buffer, uint32_t method)
+{
+	if(buffer->last == SIZE_MAX){
+		return (cobj_cmdbuf_header *)0;
+	}
+	
+	cobj_cmdbuf_header * header = (cobj_cmdbuf_header *)(buffer->memory + buffer->last);
+	return header->method == method ? header : (cobj_cmdbuf_header *)0;
+}
+
+// iterates the commands: for(header = cobj_cmdbuf_first(buffer); header; header = cobj_cmdbuf_next(buffer, header))
+static inline const cobj_cmdbuf_header * cobj_cmdbuf_first(const cobj_cmdbuf * buffer)
+{
+	return buffer->size ? (const cobj_cmdbuf_header *)buffer->memory : (const cobj_cmdbuf_header *)0;
+}
+
+static inline const cobj_cmdbuf_header * cobj_cmdbuf_next(const cobj_cmdbuf * buffer, const cobj_cmdbuf_header * header)
+{
+	const unsigned char * next = (const unsigned char *)header + header->size;
+	return next < buffer->memory + buffer->size ? (const cobj_cmdbuf_header *)next : (const cobj_cmdbuf_header *)0;
+}
+
+
+#endif /* COBJ_CMDBUF_H_ */
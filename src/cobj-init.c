@@ -0,0 +1,238 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include <time.h>
+
+#include "cobj-init.h"
+
+typedef struct init_graph {
+	cobj_init_node * nodes;
+	size_t node_count;
+	
+	pthread_mutex_t lock;
+	pthread_cond_t changed;
+	
+	// the nodes ready to initialize, and the number of nodes not finished yet
+	cobj_init_node * ready;
+	size_t remaining;
+	
+	uint64_t start_ns;
+} init_graph;
+
+static uint64_t init_now(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+// a dependency may be listed more than once
+static size_t init_dependency_count(const cobj_init_node * node, const cobj_init_node * dependency)
+{
+	size_t count = 0;
+	
+	for(size_t i = 0; i < node->dependency_count; i++){
+		count += node->dependencies[i] == dependency;
+	}
+	
+	return count;
+}
+
+static void init_reset(cobj_init_node * nodes, size_t node_count)
+{
+	for(size_t i = 0; i < node_count; i++){
+		nodes[i].status = cobj_init_status_pending;
+		nodes[i].start_ns = 0;
+		nodes[i].duration_ns = 0;
+		nodes[i].waiting = nodes[i].dependency_count;
+		nodes[i].next = NULL;
+	}
+}
+
+// the nodes don't link to the nodes depending on them, so they are searched. The graphs
+//	are small compared to the time of the initializers, and no memory is needed for the links.
+static void init_finish(init_graph * graph, cobj_init_node * node, cobj_init_status status)
+{
+	node->status = status;
+	graph->remaining--;
+	
+	for(size_t i = 0; i < graph->node_count; i++){
+		cobj_init_node * dependent = &graph->nodes[i];
+		
+		size_t count = dependent->waiting ? init_dependency_count(dependent, node) : 0;
+		
+		if(!count){
+			continue;
+		}
+		
+		// the dependent is skipped, when it's last dependency has finished
+		if(status != cobj_init_status_initialized){
+			dependent->status = cobj_init_status_skipped;
+		}
+		
+		dependent->waiting -= count;
+		
+		if(dependent->waiting == 0){
+			if(dependent->status == cobj_init_status_skipped){
+				init_finish(graph, dependent, cobj_init_status_skipped);
+			} else {
+				dependent->next = graph->ready;
+				graph->ready = dependent;
+			}
+		}
+	}
+}
+
+// the dependency may point to another array, so it's compared for equality only
+static bool init_contains(const cobj_init_node * nodes, size_t node_count, const cobj_init_node * node)
+{
+	for(size_t i = 0; i < node_count; i++){
+		if(&nodes[i] == node){
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+bool cobj_init_check(cobj_init_node * nodes, size_t node_count)
+{
+	for(size_t i = 0; i < node_count; i++){
+		for(size_t j = 0; j < nodes[i].dependency_count; j++){
+			if(!init_contains(nodes, node_count, nodes[i].dependencies[j])){
+				return false;
+			}
+		}
+	}
+	
+	// initializes the graph without calling the initializers, all nodes are finished if there is no cycle
+	init_graph graph = { .nodes = nodes, .node_count = node_count, .remaining = node_count };
+	init_reset(nodes, node_count);
+	
+	for(size_t i = 0; i < node_count; i++){
+		if(!nodes[i].waiting){
+			nodes[i].next = graph.ready;
+			graph.ready = &nodes[i];
+		}
+	}
+	
+	while(graph.ready){
+		cobj_init_node * node = graph.ready;
+		graph.ready = node->next;
+		
+		init_finish(&graph, node, cobj_init_status_initialized);
+	}
+	
+	init_reset(nodes, node_count);
+	
+	return graph.remaining == 0;
+}
+
+static void * init_worker(void * argument)
+{
+	init_graph * graph = argument;
+	
+	pthread_mutex_lock(&graph->lock);
+	
+	for(;;){
+		while(!graph->ready && graph->remaining){
+			pthread_cond_wait(&graph->changed, &graph->lock);
+		}
+		
+		if(!graph->ready){
+			break;
+		}
+		
+		cobj_init_node * node = graph->ready;
+		graph->ready = node->next;
+		
+		pthread_mutex_unlock(&graph->lock);
+		
+		uint64_t start = init_now();
+		bool initialized = node->class_descriptor->initialize(node->object, node->cold, node->parameters);
+		uint64_t end = init_now();
+		
+		pthread_mutex_lock(&graph->lock);
+		
+		node->start_ns = start - graph->start_ns;
+		node->duration_ns = end - start;
+		init_finish(graph, node, initialized ? cobj_init_status_initialized : cobj_init_status_failed);
+		
+		// the dependents may be ready now, or all nodes are finished
+		pthread_cond_broadcast(&graph->changed);
+	}
+	
+	pthread_mutex_unlock(&graph->lock);
+	
+	return NULL;
+}
+
+bool cobj_init_run(cobj_init_node * nodes, size_t node_count, pthread_t * threads, size_t thread_count)
+{
+	if(!cobj_init_check(nodes, node_count)){
+		return false;
+	}
+	
+	init_graph graph = { .nodes = nodes, .node_count = node_count, .remaining = node_count, .start_ns = init_now() };
+	
+	for(size_t i = 0; i < node_count; i++){
+		if(!nodes[i].waiting){
+			nodes[i].next = graph.ready;
+			graph.ready = &nodes[i];
+		}
+	}
+	
+	pthread_mutex_init(&graph.lock, NULL);
+	pthread_cond_init(&graph.changed, NULL);
+	
+	// the calling thread initializes objects too, so a thread which could not be created is just missing
+	size_t started = 0;
+	
+	while(started < thread_count && started + 1 < node_count){
+		if(pthread_create(&threads[started], NULL, &init_worker, &graph)){
+			break;
+		}
+		
+		started++;
+	}
+	
+	init_worker(&graph);
+	
+	for(size_t i = 0; i < started; i++){
+		pthread_join(threads[i], NULL);
+	}
+	
+	pthread_cond_destroy(&graph.changed);
+	pthread_mutex_destroy(&graph.lock);
+	
+	for(size_t i = 0; i < node_count; i++){
+		if(nodes[i].status != cobj_init_status_initialized){
+			return false;
+		}
+	}
+	
+	return true;
+}
@@ -0,0 +1,116 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef COBJ_INIT_H_
+#define COBJ_INIT_H_
+
+//////////////////////////////////////////////////////////////////////////
+// initialization of an object graph by a pool of threads
+//
+//	Each object is a node, with the nodes of the objects it depends on (for example the
+//	objects it uses in it's initializer). An object is initialized after all of it's
+//	dependencies, objects not depending on each other are initialized by different threads
+//	at the same time. So the startup takes about as long as the longest chain of
+//	dependencies, instead of the sum of all initializers.
+//
+//	The objects are initialized by the generic initializer of their class (see cobj_class_descriptor),
+//	the parameters are passed as CLASS_parameters struct. If an initializer fails, the objects
+//	depending on it are skipped, the others are still initialized.
+//
+//	static hw_gpio_pin output_pin_object;
+//	static gpio_pin_inverter inverted_pin_object;
+//	static gpio_pin pin_physical = COBJ_STATIC_REFERENCE(gpio_pin, hw_gpio_pin, output_pin_object);
+//	static const hw_gpio_pin_parameters output_pin_parameters = { .pin_nr = 14 };
+//	static const gpio_pin_inverter_parameters inverted_pin_parameters = { .pin = &pin_physical };
+//
+//	static cobj_init_node nodes[] = {
+//		COBJ_INIT_NODE(hw_gpio_pin, output_pin_object, NULL, &output_pin_parameters),
+//		COBJ_INIT_NODE(gpio_pin_inverter, inverted_pin_object, NULL, &inverted_pin_parameters,
+//			COBJ_INIT_DEPENDENCIES(&nodes[0])),
+//	};
+//
+//	pthread_t threads[4];
+//	cobj_init_run(nodes, 2, threads, 4);
+//
+//	The nodes and the threads are provided by the caller.
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include "cobj.h"
+
+typedef enum cobj_init_status {
+	cobj_init_status_pending,
+	cobj_init_status_initialized,
+	cobj_init_status_failed,
+	
+	// a dependency was not initialized
+	cobj_init_status_skipped
+} cobj_init_status;
+
+typedef struct cobj_init_node {
+	const cobj_class_descriptor * class_descriptor;
+	cobj_object * object;
+	void * cold;
+	const void * parameters;
+	
+	// the nodes which are initialized before this one
+	struct cobj_init_node * const * dependencies;
+	size_t dependency_count;
+	
+	// the result, and when the initializer was called (since cobj_init_run was called) and how long it took
+	cobj_init_status status;
+	uint64_t start_ns;
+	uint64_t duration_ns;
+	
+	// the number of dependencies not finished yet, and the link in the list of nodes ready to initialize
+	size_t waiting;
+	struct cobj_init_node * next;
+} cobj_init_node;
+
+// the initializer of a node, the optional arguments are the dependencies (COBJ_INIT_DEPENDENCIES)
+#define COBJ_INIT_NODE(GEN_CLASS_NAME, GEN_OBJECT_NAME, GEN_COLD, GEN_PARAMETERS, ...)	\
+	{	\
+		.class_descriptor = &COBJ_PP_CONCAT(GEN_CLASS_NAME, _descriptor_instance),	\
+		.object = &(GEN_OBJECT_NAME).object,	\
+		.cold = (GEN_COLD),	\
+		.parameters = (GEN_PARAMETERS),	\
+		__VA_ARGS__	\
+	}
+
+#define COBJ_INIT_DEPENDENCIES(...)	\
+	.dependencies = (cobj_init_node * const []){ __VA_ARGS__ },	\
+	.dependency_count = sizeof((cobj_init_node * const []){ __VA_ARGS__ }) / sizeof(cobj_init_node *)
+
+// returns false, if a dependency isn't one of the nodes, or the dependencies have a cycle.
+//	Called by cobj_init_run, so the graph may be checked before (for example in a test).
+bool cobj_init_check(cobj_init_node * nodes, size_t node_count);
+
+// initializes the objects by the calling thread, and up to thread_count more threads.
+//	Returns true, if all objects have been initialized (none, if cobj_init_check fails).
+bool cobj_init_run(cobj_init_node * nodes, size_t node_count, pthread_t * threads, size_t thread_count);
+
+#endif /* COBJ_INIT_H_ */
@@ -28,6 +28,17 @@ SOFTWARE.
 #include "cobjpvt-pp.h"
 #include "cobjpvt-generator-helper.h"
 
+// the runtime of the decorators generated for the interface (see COBJ_INTERFACE_WITH_...)
+#ifdef COBJ_INTERFACE_WITH_SHARED
+#	include "cobj-shared.h"
+#endif
+#ifdef COBJ_INTERFACE_WITH_CMDBUF
+#	include "cobj-cmdbuf.h"
+#endif
+#ifdef COBJ_INTERFACE_WITH_POLY
+#	include "cobj-poly.h"
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // #define the names used generators for interface "geninterface"
 // 
@@ -37,15 +48,121 @@ SOFTWARE.
 #define geninterface_descriptor COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _descriptor)
 #define geninterface_descriptor_instance COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _descriptor_instance)
 #define geninterface_queryinterface COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _queryinterface)
+#define geninterface_method_descriptors COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _method_descriptors)
+#define geninterface_proxy COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _proxy)
+#define geninterface_proxy_initialize COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _proxy_initialize)
+#define geninterface_stub_dispatch COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _stub_dispatch)
+#define geninterface_stub_serve COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _stub_serve)
+#define geninterface_shared COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _shared)
+#define geninterface_shared_set COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _shared_set)
+#define geninterface_resolve COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _resolve)
+#define geninterface_recorder COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _recorder)
+#define geninterface_recorder_initialize COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _recorder_initialize)
+#define geninterface_replay_dispatch COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _replay_dispatch)
+#define geninterface_replay COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _replay)
+#define geninterface_memo COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _memo)
+#define geninterface_memo_initialize COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _memo_initialize)
+#define geninterface_memo_invalidate COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _memo_invalidate)
+#define geninterface_cmdbuf COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _cmdbuf)
+#define geninterface_cmdbuf_initialize COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _cmdbuf_initialize)
+#define geninterface_cmdbuf_execute COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _cmdbuf_execute)
+#define geninterface_cmdbuf_reset COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _cmdbuf_reset)
+#define geninterface_synchronized COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _synchronized)
+#define geninterface_synchronized_initialize COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _synchronized_initialize)
+#define geninterface_poly_for_each COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _poly_for_each)
+
+#ifdef COBJ_INTERFACE_EXTENDS
+#	define geninterface_base_mt COBJ_PP_CONCAT(COBJ_INTERFACE_EXTENDS, _mt)
+#	define geninterface_base_reference COBJ_INTERFACE_EXTENDS
+#	define geninterface_as_base COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _as_, COBJ_INTERFACE_EXTENDS)
+#endif
+
+// the methods of the interface and it's base, for the generators implementing all of them (like the decorators),
+//	and the initializer of the base in their mt
+#ifdef COBJ_INTERFACE_EXTENDS
+#	define COBJPVT_GEN_ALL_METHOD_GENERATOR()	\
+		COBJPVT_GEN_METHOD_GENERATOR() COBJPVT_GEN_BASE_METHOD_GENERATOR()
+#	define COBJPVT_GEN_BASE_MT_INITIALIZER()	\
+		.COBJ_INTERFACE_EXTENDS = { COBJPVT_GEN_BASE_METHOD_GENERATOR() },
+#else
+#	define COBJPVT_GEN_ALL_METHOD_GENERATOR()	\
+		COBJPVT_GEN_METHOD_GENERATOR()
+#	define COBJPVT_GEN_BASE_MT_INITIALIZER()
+#endif
+
+// the interface is included by the .h file of a derived interface (COBJ_INTERFACE_INCLUDE_BASE), so a class
+//	implements it by the mt of the derived interface, and no mt of it's own is generated
+#if defined(COBJ_INTERFACE_INCLUDE_BASE) && !defined(COBJ_INTERFACE_EXTENDS)
+#	define COBJPVT_GEN_INTERFACE_AS_BASE
+#endif
 
 
 //////////////////////////////////////////////////////////////////////////
 // Generate the declarations. They are always generated when the geninterface.h is included.
 // They don't require a special state of the generator.
+COBJPVT_EXTERN_C_BEGIN
+
+// (0) frames of the async methods (COBJ_INTERFACE_ASYNC_METHOD)
+#undef COBJPVT_GEN_ASYNC_METHOD_TEMPLATE
+#define COBJPVT_GEN_ASYNC_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE)	\
+	typedef struct {	\
+		cobj_async_state state;	\
+		GEN_ARGS_MEMBERS	\
+		COBJPVT_GEN_ASYNC_RESULT(GEN_RETURN_TYPE)	\
+		COBJPVT_GEN_ASYNC_LOCALS	\
+	} COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _frame);
+#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+
+#ifdef COBJ_INTERFACE_ASYNC_LOCALS
+#	define COBJPVT_GEN_ASYNC_LOCALS	\
+		union {	\
+			max_align_t align;	\
+			unsigned char bytes[COBJ_INTERFACE_ASYNC_LOCALS];	\
+		} locals;
+#else
+#	define COBJPVT_GEN_ASYNC_LOCALS
+#endif
+
+	COBJPVT_GEN_METHOD_GENERATOR()
+
+	/*
+		Common Error:
+		unknown type name 'derived_method_frame'
+
+		Cause:
+		The base interface (COBJ_INTERFACE_EXTENDS) has an async method. This is not supported, because
+		the frame is named by the interface the methods are expanded for.
+
+		Resolution:
+		Move the async method into the derived interface, or don't derive the interface.
+	*/
+
+	/*
+		Common Error:
+		unknown type name 'cobj_async_state'
+
+		Cause:
+		The interface has an async method, but cobj-async.h isn't included. It's only needed by
+		interfaces with async methods, so the generator doesn't include it.
+
+		Resolution:
+		#include "cobj-async.h" in the .h file of the interface, before cobj-interface-generator.h.
+	*/
+
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+#undef COBJPVT_GEN_ASYNC_METHOD_TEMPLATE
+#undef COBJPVT_GEN_ASYNC_LOCALS
+#define COBJPVT_GEN_ASYNC_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE)
 
 // (1) mt (methodtable) struct declaration
 typedef struct {
 	
+	#ifdef COBJ_INTERFACE_EXTENDS
+		// the mt of the base interface is always the first member. So the mt of this interface
+		// can be used as mt for the base too (the layout is prefix-compatible)
+		geninterface_base_mt COBJ_INTERFACE_EXTENDS;
+	#endif
+	
 	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
 		GEN_RETURN_TYPE (*GEN_METHODNAME)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE);
 			COBJPVT_GEN_METHOD_GENERATOR()
@@ -81,6 +198,38 @@ typedef struct {
 	
 } geninterface_mt;
 
+#ifdef COBJ_INTERFACE_EXTENDS
+	// the mt of the derived interface initializes the methods of the base from it's NAME_methods x-macro only,
+	//	so the base must not extend another interface
+	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+		+1
+	COBJPVT_ASSERT(sizeof(geninterface_base_mt) == (0 COBJPVT_GEN_BASE_METHOD_GENERATOR()) * sizeof(void (*)(void)),
+		"the base interface extends another interface, only one level of COBJ_INTERFACE_EXTENDS is supported");
+	#undef COBJPVT_GEN_METHOD_TEMPLATE
+#endif
+
+// (1.1) the index of each method in the mt, INTERFACE_METHOD_method_index. The generators writing calls as
+//	messages (see cobj-remote.h, cobj-record.h, cobj-cmdbuf.h) identify the method by it.
+enum {
+	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+		COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _method_index) = COBJPVT_GEN_METHOD_INDEX(geninterface_mt, COBJPVT_GEN_METHOD_INDEX_MEMBER(GEN_METHODNAME)),
+	#define COBJPVT_GEN_METHOD_INDEX_MEMBER(GEN_METHODNAME)	\
+		GEN_METHODNAME
+	
+	COBJPVT_GEN_METHOD_GENERATOR()
+	
+#ifdef COBJ_INTERFACE_EXTENDS
+	#undef COBJPVT_GEN_METHOD_INDEX_MEMBER
+	#define COBJPVT_GEN_METHOD_INDEX_MEMBER(GEN_METHODNAME)	\
+		COBJ_INTERFACE_EXTENDS.GEN_METHODNAME
+	
+	COBJPVT_GEN_BASE_METHOD_GENERATOR()
+#endif
+	
+	#undef COBJPVT_GEN_METHOD_INDEX_MEMBER
+	#undef COBJPVT_GEN_METHOD_TEMPLATE
+};
+
 // (2) strong-typed reference-struct
 typedef struct {
 	geninterface_mt * mt;
@@ -94,11 +243,366 @@ extern const cobj_interface_descriptor * const geninterface_descriptor;
 bool geninterface_queryinterface(cobj_object * object, geninterface_reference * reference);
 
 // (5) forward declarations to thunks
+//	If the profile (see cobj-profile.h) names the class for a method, it's not implemented by the
+//	interface-registry, but inline with a guarded direct call to the thunk of this class
 #define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
-	GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(const geninterface_reference * reference GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE);
+	COBJPVT_GEN_PROFILE_SELECT(GEN_METHODNAME, COBJPVT_GEN_INTERFACE_METHOD_DECLARATION)(COBJPVT_GEN_PROFILE(GEN_METHODNAME), GEN_METHODNAME, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, (GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE), (GEN_ARGS_SEPERATOR GEN_ARGS_NAME))
+
+#define COBJPVT_GEN_INTERFACE_METHOD_DECLARATION_0(GEN_PROFILE, GEN_METHODNAME, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_SEPERATED_ARGS_SIGNATURE, GEN_SEPERATED_ARGS_NAME)	\
+	GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(const geninterface_reference * reference COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_SIGNATURE));
+
+#define COBJPVT_GEN_INTERFACE_METHOD_DECLARATION_1(GEN_PROFILE, GEN_METHODNAME, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_SEPERATED_ARGS_SIGNATURE, GEN_SEPERATED_ARGS_NAME)	\
+	extern GEN_RETURN_TYPE COBJPVT_GEN_PROFILE_THUNK(GEN_PROFILE, GEN_METHODNAME)(cobj_object * self COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_SIGNATURE));	\
+	static inline GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(const geninterface_reference * reference COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_SIGNATURE)) {	\
+		if(reference->mt->GEN_METHODNAME == &COBJPVT_GEN_PROFILE_THUNK(GEN_PROFILE, GEN_METHODNAME)) {	\
+			GEN_RETURN_STATEMENT COBJPVT_GEN_PROFILE_THUNK(GEN_PROFILE, GEN_METHODNAME)(reference->object COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_NAME));	\
+		} else {	\
+			GEN_RETURN_STATEMENT reference->mt->GEN_METHODNAME(reference->object COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_NAME));	\
+		}	\
+	}
 	
 	COBJPVT_GEN_METHOD_GENERATOR()
+	
+	/*
+		Common Error:
+		undefined reference to `class_interface_method_thunk'
+
+		Cause:
+		The profile names a class for the method, which is not linked into the program.
+
+		Resolution:
+		Use a profile, which was recorded with the same classes, or remove the line from the profile.
+	*/
+	
 #undef COBJPVT_GEN_METHOD_TEMPLATE
+#undef COBJPVT_GEN_INTERFACE_METHOD_DECLARATION_0
+#undef COBJPVT_GEN_INTERFACE_METHOD_DECLARATION_1
+
+#ifdef COBJ_INTERFACE_EXTENDS
+
+	// (6) upcast to the base interface. It's just a different view to the same mt, so no queryinterface is needed
+	static inline geninterface_base_reference geninterface_as_base(const geninterface_reference * reference)
+	{
+		geninterface_base_reference base_reference;
+		base_reference.mt = &reference->mt->COBJ_INTERFACE_EXTENDS;
+		base_reference.object = reference->object;
+		return base_reference;
+	}
+
+	// (7) the methods of the base interface, callable on this interface.
+	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+		static inline GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(const geninterface_reference * reference GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+			GEN_RETURN_STATEMENT reference->mt->COBJ_INTERFACE_EXTENDS.GEN_METHODNAME(reference->object GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
+		}
+		
+		COBJPVT_GEN_BASE_METHOD_GENERATOR()
+		
+		/*
+			Common Error:
+			'base_methods' undeclared here / expected identifier before 'base_methods':
+
+			Cause:
+			The base interface doesn't define it's methods with the NAME_methods x-macro.
+
+			Resolution:
+			Define the methods of the base interface like:
+			#define base_methods	COBJ_INTERFACE_METHOD(void, foo)
+			#define COBJ_INTERFACE_METHODS	base_methods
+		*/
+	#undef COBJPVT_GEN_METHOD_TEMPLATE
+
+#endif
+
+// (8) start of the async methods. The frame is initialized with the arguments, and polled the first time.
+//	The caller polls it with INTERFACE_METHOD_poll until COBJ_ASYNC_DONE is returned, the result is in frame->result.
+#undef COBJPVT_GEN_ASYNC_METHOD_TEMPLATE
+#define COBJPVT_GEN_ASYNC_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE)	\
+	static inline cobj_async_status COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _start)(const geninterface_reference * reference, COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _frame) * frame GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _frame) initial = COBJPVT_ZERO_INITIALIZER;	\
+		*frame = initial;	\
+		frame->state = COBJ_ASYNC_STATE_INIT;	\
+		GEN_ARGS_STORE	\
+		return COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _poll)(reference, frame);	\
+	}
+#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+
+	COBJPVT_GEN_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+#undef COBJPVT_GEN_ASYNC_METHOD_TEMPLATE
+#define COBJPVT_GEN_ASYNC_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE)
+
+// The decorators and helpers (8.1) - (8.9) are only declared, if the interface opts in by the
+//	COBJ_INTERFACE_WITH_... define of each, so the clients don't need their runtime headers.
+
+// (8.1) proxy and stub, for calls from another process (see cobj-remote.h). They are implemented
+//	where the interface is included in COBJ_INTERFACE_REMOTE_MODE.
+#ifdef COBJ_INTERFACE_WITH_REMOTE
+struct cobj_remote_channel;
+struct cobj_remote_ring;
+struct cobj_remote_header;
+
+typedef union {
+	struct {
+		const cobj_class_descriptor * class_desriptor;
+		struct cobj_remote_channel * channel;
+	} private_data;
+	cobj_object object;
+} geninterface_proxy;
+
+bool geninterface_proxy_initialize(geninterface_proxy * self, struct cobj_remote_channel * channel);
+bool geninterface_stub_dispatch(const void * target, const struct cobj_remote_header * request, struct cobj_remote_channel * channel);
+void geninterface_stub_serve(struct cobj_remote_channel * channel, const geninterface_reference * target);
+#endif
+
+// (8.2) references stored in shared memory, relative to their own address (see cobj-shared.h).
+//	They are resolved with the mt of the class in the calling process.
+#ifdef COBJ_INTERFACE_WITH_SHARED
+typedef struct {
+	cobj_shared_offset object;
+} geninterface_shared;
+
+static inline void geninterface_shared_set(geninterface_shared * shared, cobj_object * object)
+{
+	cobj_shared_offset_set(&shared->object, object);
+}
+
+static inline bool geninterface_resolve(const geninterface_shared * shared, geninterface_reference * reference)
+{
+	cobj_object * object = cobj_shared_offset_get(&shared->object);
+	cobj_mt mt = object ? cobj_shared_queryinterface(object, geninterface_descriptor) : (cobj_mt)0;
+	
+	if(!mt){
+		return false;
+	}
+	
+	reference->mt = (geninterface_mt*)mt;
+	reference->object = object;
+	
+	return true;
+}
+#endif
+
+// (8.3) recorder and replay, for benchmarks with recorded calls (see cobj-record.h). They are implemented
+//	where the interface is included in COBJ_INTERFACE_RECORD_MODE.
+#ifdef COBJ_INTERFACE_WITH_RECORD
+struct cobj_record_writer;
+struct cobj_record_header;
+struct cobj_record_stats;
+
+typedef union {
+	struct {
+		const cobj_class_descriptor * class_desriptor;
+		geninterface_reference target;
+		struct cobj_record_writer * writer;
+	} private_data;
+	cobj_object object;
+} geninterface_recorder;
+
+bool geninterface_recorder_initialize(geninterface_recorder * self, const geninterface_reference * target, struct cobj_record_writer * writer);
+bool geninterface_replay_dispatch(const void * target, const struct cobj_record_header * record);
+bool geninterface_replay(const char * path, const geninterface_reference * target, bool paced, struct cobj_record_stats * stats);
+#endif
+
+// (8.4) memo, caching the results of the pure methods (see COBJ_INTERFACE_PURE_METHOD). The cache of a method
+//	holds the last COBJ_INTERFACE_MEMO_SLOTS results, keyed by the arguments. The entries are valid while their
+//	generation is the generation of the memo, which is incremented by the mutating methods. It's implemented
+//	where the interface is included in COBJ_INTERFACE_MEMO_MODE.
+#ifdef COBJ_INTERFACE_WITH_MEMO
+#ifndef COBJ_INTERFACE_MEMO_SLOTS
+#	define COBJ_INTERFACE_MEMO_SLOTS 4
+#endif
+
+#define COBJPVT_GEN_MEMO_KEY(GEN_METHODNAME)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _memo_key)
+#define COBJPVT_GEN_MEMO_ENTRY(GEN_METHODNAME)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _memo_entry)
+#define COBJPVT_GEN_MEMO_CACHE(GEN_METHODNAME)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _memo_cache)
+
+// the arguments are compared member by member, memo_none keeps the key valid without arguments
+#define COBJPVT_GEN_MEMO_TYPES_0(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_ARGS_MEMBERS)
+#define COBJPVT_GEN_MEMO_TYPES_1(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_ARGS_MEMBERS)	\
+	typedef struct {	\
+		char memo_none;	\
+		GEN_ARGS_MEMBERS	\
+	} COBJPVT_GEN_MEMO_KEY(GEN_METHODNAME);	\
+	typedef struct {	\
+		uint64_t generation;	\
+		COBJPVT_GEN_MEMO_KEY(GEN_METHODNAME) key;	\
+		GEN_RETURN_TYPE result;	\
+	} COBJPVT_GEN_MEMO_ENTRY(GEN_METHODNAME);	\
+	typedef struct {	\
+		COBJPVT_GEN_MEMO_ENTRY(GEN_METHODNAME) entries[COBJ_INTERFACE_MEMO_SLOTS];	\
+		unsigned int next;	\
+	} COBJPVT_GEN_MEMO_CACHE(GEN_METHODNAME);
+
+#define COBJPVT_GEN_MEMO_MEMBER_0(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_ARGS_MEMBERS)
+#define COBJPVT_GEN_MEMO_MEMBER_1(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_ARGS_MEMBERS)	\
+	COBJPVT_GEN_MEMO_CACHE(GEN_METHODNAME) COBJ_PP_CONCAT(GEN_METHODNAME, _cache);
+
+#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_MEMO_TYPES)(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_ARGS_MEMBERS)
+
+	COBJPVT_GEN_ALL_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_MEMO_MEMBER)(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_ARGS_MEMBERS)
+
+typedef union {
+	struct {
+		const cobj_class_descriptor * class_desriptor;
+		geninterface_reference target;
+		uint64_t generation;
+		
+		COBJPVT_GEN_ALL_METHOD_GENERATOR()
+	} private_data;
+	cobj_object object;
+} geninterface_memo;
+
+#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE		COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+
+bool geninterface_memo_initialize(geninterface_memo * self, const geninterface_reference * target);
+
+// drops all cached results, needed if the object is changed without calling the memo
+static inline void geninterface_memo_invalidate(geninterface_memo * self)
+{
+	self->private_data.generation++;
+}
+#endif
+
+// (8.5) command buffer, capturing the calls to execute them as a batch later (see cobj-cmdbuf.h).
+//	It's implemented where the interface is included in COBJ_INTERFACE_CMDBUF_MODE.
+#ifdef COBJ_INTERFACE_WITH_CMDBUF
+typedef union {
+	struct {
+		const cobj_class_descriptor * class_desriptor;
+		cobj_cmdbuf buffer;
+	} private_data;
+	cobj_object object;
+} geninterface_cmdbuf;
+
+bool geninterface_cmdbuf_initialize(geninterface_cmdbuf * self, void * memory, size_t capacity);
+bool geninterface_cmdbuf_execute(const geninterface_cmdbuf * self, const geninterface_reference * target);
+
+static inline void geninterface_cmdbuf_reset(geninterface_cmdbuf * self)
+{
+	cobj_cmdbuf_reset(&self->private_data.buffer);
+}
+#endif
+
+// (8.6) synchronized decorator, calling the target while holding a reader/writer lock (see cobj-synchronized.h).
+//	It's implemented where the interface is included in COBJ_INTERFACE_SYNCHRONIZED_MODE.
+#ifdef COBJ_INTERFACE_WITH_SYNCHRONIZED
+struct cobj_rwlock;
+
+typedef union {
+	struct {
+		const cobj_class_descriptor * class_desriptor;
+		geninterface_reference target;
+		struct cobj_rwlock * lock;
+	} private_data;
+	cobj_object object;
+} geninterface_synchronized;
+
+bool geninterface_synchronized_initialize(geninterface_synchronized * self, const geninterface_reference * target, struct cobj_rwlock * lock);
+#endif
+
+// (8.7) packed arguments of the methods, for cobj_invoke (see the reflection in cobj.h)
+#undef COBJPVT_GEN_METHOD_REFLECT_TEMPLATE
+#define COBJPVT_GEN_METHOD_REFLECT_TEMPLATE(GEN_METHOD_KIND, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD, GEN_ARGS_LIST)	\
+	typedef struct {	\
+		char arguments_none;	\
+		GEN_ARGS_MEMBERS	\
+	} COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _arguments);
+#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+
+	COBJPVT_GEN_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+#undef COBJPVT_GEN_METHOD_REFLECT_TEMPLATE
+#define COBJPVT_GEN_METHOD_REFLECT_TEMPLATE(GEN_METHOD_KIND, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD, GEN_ARGS_LIST)
+
+// (8.8) iteration of the objects in a polymorphic collection, one segment after the other (see cobj-poly.h).
+//	It's inline, so a constant function can be inlined into the loop.
+#ifdef COBJ_INTERFACE_WITH_POLY
+static inline void geninterface_poly_for_each(const cobj_poly_collection * collection, void (*function)(const geninterface_reference * reference, void * context), void * context)
+{
+	for(size_t i = 0; i < collection->segments_count; i++){
+		cobj_poly_range range = cobj_poly_segment_range(&collection->segments[i], geninterface_descriptor);
+		
+		if(!range.mt){
+			continue;
+		}
+		
+		// the mt is the same for all objects of the segment
+		geninterface_reference reference;
+		reference.mt = (geninterface_mt *)range.mt;
+		
+		for(unsigned char * object = range.begin; object < range.end; object += range.object_size){
+			reference.object = (cobj_object *)object;
+			function(&reference, context);
+		}
+	}
+}
+#endif
+
+// (8.9) delegates: a method bound to the object of a reference. The method is loaded from the mt once by
+//	INTERFACE_METHOD_bind, INTERFACE_METHOD_delegate_call calls it without loading the mt again.
+//	The delegates of the base methods are the ones of the base interface, so it opts in too.
+#ifdef COBJ_INTERFACE_WITH_DELEGATES
+#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+	typedef struct {	\
+		GEN_RETURN_TYPE (*method)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE);	\
+		cobj_object * object;	\
+	} COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _delegate);	\
+	static inline COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _delegate) COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _bind)(const geninterface_reference * reference) {	\
+		COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _delegate) delegate;	\
+		delegate.method = reference->mt->GEN_METHODNAME;	\
+		delegate.object = reference->object;	\
+		return delegate;	\
+	}	\
+	static inline GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _delegate_call)(COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _delegate) delegate GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		GEN_RETURN_STATEMENT delegate.method(delegate.object GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
+	}
+
+	COBJPVT_GEN_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+
+#ifdef COBJ_INTERFACE_EXTENDS
+
+	// the delegates of the base methods are the ones of the base interface, bound by the mt of the base
+	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+		typedef COBJ_PP_CONCAT(COBJ_INTERFACE_EXTENDS, _, GEN_METHODNAME, _delegate) COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _delegate);	\
+		static inline COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _delegate) COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _bind)(const geninterface_reference * reference) {	\
+			COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _delegate) delegate;	\
+			delegate.method = reference->mt->COBJ_INTERFACE_EXTENDS.GEN_METHODNAME;	\
+			delegate.object = reference->object;	\
+			return delegate;	\
+		}	\
+		static inline GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _delegate_call)(COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _delegate) delegate GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+			GEN_RETURN_STATEMENT delegate.method(delegate.object GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
+		}
+		
+		COBJPVT_GEN_BASE_METHOD_GENERATOR()
+		
+	#undef COBJPVT_GEN_METHOD_TEMPLATE
+
+#endif
+#endif
+
+COBJPVT_EXTERN_C_END
+
+// (9) C++ layer (see cobj.hpp)
+#if defined(__cplusplus) && __cplusplus >= 202002L
+#	include "cobjpvt-generator-interface-cpp.h"
+#endif
 
 //////////////////////////////////////////////////////////////////////////
 // Create the implementation. Generator needs to be in COBJ_INTERFACE_IMPLEMENTATION_MODE,
@@ -111,19 +615,9 @@ bool geninterface_queryinterface(cobj_object * object, geninterface_reference *
 	#include "cobjpvt-generator-class-defines.h"
 
 	//////////////////////////////////////////////////////////////////////////
-	// (1) strong typed object_struct
-	//	This struct is also in cobj-classheader-generator.h! See the comments here and there!
-	#ifndef COBJPVT_GEN_OBJECT_STRUCT_GENERATED
-		#define COBJPVT_GEN_OBJECT_STRUCT_GENERATED
-		// here we are already define our object-struct, because we need it for the thunks
-	typedef struct {
-		cobj_class_descriptor * class_desriptor;
-		#define COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
-			GEN_VARIABLE_TYPE GEN_VARIABLE_NAME;
-		COBJPVT_GEN_CLASS_VARIABLE_GENERATOR()
-		#undef COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE	
-	} genclass_object_impl;
-	#endif
+	// (0) strong typed object_struct
+	//	The thunks need it, so it's generated by the first interface
+	#include "cobjpvt-generator-class-layout.h"
 
 	//////////////////////////////////////////////////////////////////////////
 	// (1) declare the implementation methods
@@ -135,24 +629,45 @@ bool geninterface_queryinterface(cobj_object * object, geninterface_reference *
 
 	//////////////////////////////////////////////////////////////////////////
 	// (2) declare thunks
+	//	They are static, except for the methods named by a profile (see cobj-profile.h): the interface methods
+	//	call them directly, so they are prefixed with the class name
+	#define COBJPVT_GEN_THUNK_LINKAGE_0	static
+	#define COBJPVT_GEN_THUNK_LINKAGE_1
+	#define COBJPVT_GEN_THUNK_LINKAGE(GEN_METHODNAME)	COBJPVT_GEN_PROFILE_SELECT(GEN_METHODNAME, COBJPVT_GEN_THUNK_LINKAGE)
+	
 	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
-		static GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _thunk)(cobj_object* self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE);
+		COBJPVT_GEN_THUNK_LINKAGE(GEN_METHODNAME) GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _thunk)(cobj_object* self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE);
 			
 		COBJ_INTERFACE_METHODS
 	#undef COBJPVT_GEN_METHOD_TEMPLATE
 
 	//////////////////////////////////////////////////////////////////////////
 	// (3) implement thunks
+	//	In the tracing build (COBJ_USDT), the result is stored, to have a probe after the call
+	#ifdef COBJ_USDT
 	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
-		static GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _thunk)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		COBJPVT_GEN_THUNK_LINKAGE(GEN_METHODNAME) GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _thunk)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+			COBJPVT_GEN_USDT_PROBE(entry, GEN_METHODNAME)	\
+			COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_USDT_RESULT)(GEN_RETURN_TYPE) COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _impl)((genclass_object_impl*)self GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
+			COBJPVT_GEN_USDT_PROBE(return, GEN_METHODNAME)	\
+			COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_USDT_RETURN)()	\
+		}
+	#define COBJPVT_GEN_USDT_RESULT_0(GEN_RETURN_TYPE)
+	#define COBJPVT_GEN_USDT_RESULT_1(GEN_RETURN_TYPE)	GEN_RETURN_TYPE usdt_result =
+	#define COBJPVT_GEN_USDT_RETURN_0()
+	#define COBJPVT_GEN_USDT_RETURN_1()	return usdt_result;
+	#else
+	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+		COBJPVT_GEN_THUNK_LINKAGE(GEN_METHODNAME) GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _thunk)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
 			GEN_RETURN_STATEMENT COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _impl)((genclass_object_impl*)self GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
 		}
+	#endif
 			
 		COBJ_INTERFACE_METHODS
 
 		/*
 			Common Error:
-			src.o: In function `interface_method_thunk':
+			src.o: In function `class_interface_method_thunk':
 			undefined reference to `interface_method_impl'
 
 			Cause:
@@ -171,19 +686,88 @@ bool geninterface_queryinterface(cobj_object * object, geninterface_reference *
 
 
 	#undef COBJPVT_GEN_METHOD_TEMPLATE
+	#undef COBJPVT_GEN_THUNK_LINKAGE_0
+	#undef COBJPVT_GEN_THUNK_LINKAGE_1
+	#undef COBJPVT_GEN_THUNK_LINKAGE
+	#undef COBJPVT_GEN_USDT_RESULT_0
+	#undef COBJPVT_GEN_USDT_RESULT_1
+	#undef COBJPVT_GEN_USDT_RETURN_0
+	#undef COBJPVT_GEN_USDT_RETURN_1
 	
 	//////////////////////////////////////////////////////////////////////////
 	// (4) build the MethodTable, to the thunks
+	//	It's not static, because it's referenced by COBJ_STATIC_REFERENCE. A base interface included by a
+	//	derived one has no mt, the thunks are used by the mt of the derived interface.
+	#ifndef COBJPVT_GEN_INTERFACE_AS_BASE
+	const geninterface_mt COBJ_PP_CONCAT(COBJ_CLASS_NAME, _ , geninterface_mt) = {
+	
+	#ifdef COBJ_INTERFACE_EXTENDS
+		// the base interface uses the thunks, generated when it's .h was included
+		.COBJ_INTERFACE_EXTENDS = {
+		#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+			.GEN_METHODNAME = &COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, COBJ_INTERFACE_EXTENDS, _, GEN_METHODNAME, _thunk),
+			
+			COBJPVT_GEN_BASE_METHOD_GENERATOR()
+		#undef COBJPVT_GEN_METHOD_TEMPLATE
+		},
+	#endif
+	
+	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+		.GEN_METHODNAME = &COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _thunk),
+			
+		COBJ_INTERFACE_METHODS
+	#undef COBJPVT_GEN_METHOD_TEMPLATE
+	
+	};
+	#endif
+	
+	//////////////////////////////////////////////////////////////////////////
+	// (5) the proxy of a lazy class (COBJ_CLASS_LAZY). The thunks initialize the object on the first call,
+	//	and call the thunks of the class directly, so only the state is checked after that.
+	//	If the initializer failed, the methods return zero.
+	#ifdef COBJ_CLASS_LAZY
+	#define COBJPVT_GEN_LAZY_FAILED_0(GEN_RETURN_TYPE)	\
+		return;
+	#define COBJPVT_GEN_LAZY_FAILED_1(GEN_RETURN_TYPE)	\
+		GEN_RETURN_TYPE failed_result = COBJPVT_ZERO_INITIALIZER;	\
+		return failed_result;
+	
+	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+		static GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _lazy_thunk)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+			cobj_object * target = lazy_target(self);	\
+			if(!target) {	\
+				COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_LAZY_FAILED)(GEN_RETURN_TYPE)	\
+			}	\
+			GEN_RETURN_STATEMENT COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _thunk)(target GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
+		}
+			
+		COBJ_INTERFACE_METHODS
+	#undef COBJPVT_GEN_METHOD_TEMPLATE
+	#undef COBJPVT_GEN_LAZY_FAILED_0
+	#undef COBJPVT_GEN_LAZY_FAILED_1
 	
-	static const geninterface_mt COBJ_PP_CONCAT(COBJ_CLASS_NAME, _ , geninterface_mt) = {
+	#ifndef COBJPVT_GEN_INTERFACE_AS_BASE
+	const geninterface_mt COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, COBJ_INTERFACE_NAME, _lazy_mt) = {
+	
+	#ifdef COBJ_INTERFACE_EXTENDS
+		.COBJ_INTERFACE_EXTENDS = {
+		#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+			.GEN_METHODNAME = &COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, COBJ_INTERFACE_EXTENDS, _, GEN_METHODNAME, _lazy_thunk),
+			
+			COBJPVT_GEN_BASE_METHOD_GENERATOR()
+		#undef COBJPVT_GEN_METHOD_TEMPLATE
+		},
+	#endif
 	
 	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
-		.GEN_METHODNAME = &COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _thunk),
+		.GEN_METHODNAME = &COBJ_PP_CONCAT(COBJ_CLASS_NAME, _, COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _lazy_thunk),
 			
 		COBJ_INTERFACE_METHODS
 	#undef COBJPVT_GEN_METHOD_TEMPLATE
 	
 	};
+	#endif
+	#endif
 	
 #endif
 #endif
@@ -192,6 +776,9 @@ bool geninterface_queryinterface(cobj_object * object, geninterface_reference *
 //	Generate interface-registry for this interface
 #ifdef COBJ_INTERFACE_REGISTRY_MODE
 	
+	// the results of the reflection are copied by memcpy
+	#include <string.h>
+	
 	// (1) implement strong-typed query-interface
 	bool geninterface_queryinterface(cobj_object * object, geninterface_reference * reference) {
 		cobj_mt mt = object->class_descriptor->queryinterface(geninterface_descriptor);
@@ -206,18 +793,103 @@ bool geninterface_queryinterface(cobj_object * object, geninterface_reference *
 	}
 
 	// (2) implement thunks
+	//	methods devirtualized by the profile are already implemented inline by the declaration
 	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
-		GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(const geninterface_reference * reference GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
-			GEN_RETURN_STATEMENT reference->mt->GEN_METHODNAME(reference->object GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
+		COBJPVT_GEN_PROFILE_SELECT(GEN_METHODNAME, COBJPVT_GEN_INTERFACE_METHOD_IMPLEMENTATION)(COBJPVT_GEN_PROFILE(GEN_METHODNAME), GEN_METHODNAME, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, (GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE), (GEN_ARGS_SEPERATOR GEN_ARGS_NAME))
+	
+	#define COBJPVT_GEN_INTERFACE_METHOD_IMPLEMENTATION_0(GEN_PROFILE, GEN_METHODNAME, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_SEPERATED_ARGS_SIGNATURE, GEN_SEPERATED_ARGS_NAME)	\
+		GEN_RETURN_TYPE COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(const geninterface_reference * reference COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_SIGNATURE)) {	\
+			COBJPVT_GEN_PROFILE_RECORD(GEN_METHODNAME)	\
+			GEN_RETURN_STATEMENT reference->mt->GEN_METHODNAME(reference->object COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_NAME));	\
+		}
+	
+	#define COBJPVT_GEN_INTERFACE_METHOD_IMPLEMENTATION_1(GEN_PROFILE, GEN_METHODNAME, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_SEPERATED_ARGS_SIGNATURE, GEN_SEPERATED_ARGS_NAME)
+	
+	COBJPVT_GEN_METHOD_GENERATOR()
+	
+	#undef COBJPVT_GEN_METHOD_TEMPLATE
+	#undef COBJPVT_GEN_INTERFACE_METHOD_IMPLEMENTATION_0
+	#undef COBJPVT_GEN_INTERFACE_METHOD_IMPLEMENTATION_1
+	
+	// (3) implement the reflection: the descriptors of the arguments, invoke and the descriptors of the methods
+	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+	#undef COBJPVT_GEN_METHOD_REFLECT_TEMPLATE
+	#define COBJPVT_GEN_METHOD_REFLECT_TEMPLATE(GEN_METHOD_KIND, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD, GEN_ARGS_LIST)	\
+		static const cobj_argument_descriptor COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _argument_descriptors)[] = {	\
+			COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS(COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _arguments), COBJPVT_PP_REMOVE_PARENS(GEN_ARGS_LIST))	\
+			{ 0 }	\
+		};
+	
+	COBJPVT_GEN_METHOD_GENERATOR()
+	
+	// invoke unpacks the arguments, and calls the method through the mt of the reference. The frame is not
+	//	const, because array arguments (like va_list) would be const then. The result is copied after the call,
+	//	so it may be unaligned.
+	#define COBJPVT_GEN_REFLECT_RESULT_0(GEN_RETURN_TYPE)
+	#define COBJPVT_GEN_REFLECT_RESULT_1(GEN_RETURN_TYPE)	GEN_RETURN_TYPE invoke_result =
+	#define COBJPVT_GEN_REFLECT_STORE_0(GEN_RETURN_TYPE)
+	#define COBJPVT_GEN_REFLECT_STORE_1(GEN_RETURN_TYPE)	\
+		if(result){	\
+			memcpy(result, &invoke_result, sizeof(GEN_RETURN_TYPE));	\
+		}
+	
+	#undef COBJPVT_GEN_METHOD_REFLECT_TEMPLATE
+	#define COBJPVT_GEN_METHOD_REFLECT_TEMPLATE(GEN_METHOD_KIND, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD, GEN_ARGS_LIST)	\
+		static void COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _invoke)(const void * invoke_reference, const void * arguments, void * result) {	\
+			const geninterface_reference * reference = (const geninterface_reference *)invoke_reference;	\
+			COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _arguments) * frame = (COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _arguments) *)arguments;	\
+			(void)frame;	\
+			(void)result;	\
+			COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_REFLECT_RESULT)(GEN_RETURN_TYPE) reference->mt->GEN_METHODNAME(reference->object GEN_ARGS_SEPERATOR GEN_ARGS_LOAD);	\
+			COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_REFLECT_STORE)(GEN_RETURN_TYPE)	\
 		}
 	
 	COBJPVT_GEN_METHOD_GENERATOR()
+	
+	#define COBJPVT_GEN_REFLECT_RESULT_SIZE_0(GEN_RETURN_TYPE)	0
+	#define COBJPVT_GEN_REFLECT_RESULT_SIZE_1(GEN_RETURN_TYPE)	sizeof(GEN_RETURN_TYPE)
+	
+	#undef COBJPVT_GEN_METHOD_REFLECT_TEMPLATE
+	#define COBJPVT_GEN_METHOD_REFLECT_TEMPLATE(GEN_METHOD_KIND, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD, GEN_ARGS_LIST)	\
+		{	\
+			.method_name = COBJPVT_PP_STRINGIFY(GEN_METHODNAME),	\
+			.kind = GEN_METHOD_KIND,	\
+			.index = COBJPVT_GEN_METHOD_INDEX(geninterface_mt, GEN_METHODNAME),	\
+			.return_type_name = COBJPVT_PP_STRINGIFY(GEN_RETURN_TYPE),	\
+			.return_size = COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_REFLECT_RESULT_SIZE)(GEN_RETURN_TYPE),	\
+			.arguments_count = sizeof(COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _argument_descriptors)) / sizeof(cobj_argument_descriptor) - 1,	\
+			.arguments = COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _argument_descriptors),	\
+			.arguments_size = sizeof(COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _arguments)),	\
+			.invoke = &COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _invoke),	\
+		},
+	
+	static const cobj_method_descriptor geninterface_method_descriptors[] = {
+		COBJPVT_GEN_METHOD_GENERATOR()
+		{ 0 }
+	};
+	
 	#undef COBJPVT_GEN_METHOD_TEMPLATE
+	#undef COBJPVT_GEN_METHOD_REFLECT_TEMPLATE
+	#undef COBJPVT_GEN_REFLECT_RESULT_SIZE_0
+	#undef COBJPVT_GEN_REFLECT_RESULT_SIZE_1
+	#undef COBJPVT_GEN_REFLECT_RESULT_0
+	#undef COBJPVT_GEN_REFLECT_RESULT_1
+	#undef COBJPVT_GEN_REFLECT_STORE_0
+	#undef COBJPVT_GEN_REFLECT_STORE_1
+	#define COBJPVT_GEN_METHOD_REFLECT_TEMPLATE(GEN_METHOD_KIND, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD, GEN_ARGS_LIST)
 	
-	// (3) implement the descriptor
+	// (4) implement the descriptor
 	static const cobj_interface_descriptor geninterface_descriptor_instance = {
 		.interface_name = COBJPVT_PP_STRINGIFY(COBJ_INTERFACE_NAME),
+	#ifdef COBJ_INTERFACE_EXTENDS
+		.base_interface = &COBJ_PP_CONCAT(COBJ_INTERFACE_EXTENDS, _descriptor),
+	#endif
+		.methods = geninterface_method_descriptors,
 		.methods_count = 0
+	#ifdef COBJ_INTERFACE_EXTENDS
+			// the methods of the base are part of the mt too
+			+ sizeof(geninterface_base_mt) / sizeof(void (*)(void))
+	#endif
 		#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
 			+1	
 		COBJPVT_GEN_METHOD_GENERATOR()
@@ -228,13 +900,106 @@ bool geninterface_queryinterface(cobj_object * object, geninterface_reference *
 
 #endif
 
+//////////////////////////////////////////////////////////////////////////
+//	Generate proxy and stub for this interface (see cobj-remote.h)
+#ifdef COBJ_INTERFACE_REMOTE_MODE
+#	ifndef COBJ_INTERFACE_WITH_REMOTE
+#		error "the interface is included in COBJ_INTERFACE_REMOTE_MODE, but it doesn't define COBJ_INTERFACE_WITH_REMOTE"
+#	endif
+#	include "cobjpvt-generator-interface-remote.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+//	Generate recorder and replay for this interface (see cobj-record.h)
+#ifdef COBJ_INTERFACE_RECORD_MODE
+#	ifndef COBJ_INTERFACE_WITH_RECORD
+#		error "the interface is included in COBJ_INTERFACE_RECORD_MODE, but it doesn't define COBJ_INTERFACE_WITH_RECORD"
+#	endif
+#	include "cobjpvt-generator-interface-record.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+//	Generate the memo for this interface (see COBJ_INTERFACE_PURE_METHOD)
+#ifdef COBJ_INTERFACE_MEMO_MODE
+#	ifndef COBJ_INTERFACE_WITH_MEMO
+#		error "the interface is included in COBJ_INTERFACE_MEMO_MODE, but it doesn't define COBJ_INTERFACE_WITH_MEMO"
+#	endif
+#	include "cobjpvt-generator-interface-memo.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+//	Generate the command buffer for this interface (see cobj-cmdbuf.h)
+#ifdef COBJ_INTERFACE_CMDBUF_MODE
+#	ifndef COBJ_INTERFACE_WITH_CMDBUF
+#		error "the interface is included in COBJ_INTERFACE_CMDBUF_MODE, but it doesn't define COBJ_INTERFACE_WITH_CMDBUF"
+#	endif
+#	include "cobjpvt-generator-interface-cmdbuf.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+//	Generate the synchronized decorator for this interface (see cobj-synchronized.h)
+#ifdef COBJ_INTERFACE_SYNCHRONIZED_MODE
+#	ifndef COBJ_INTERFACE_WITH_SYNCHRONIZED
+#		error "the interface is included in COBJ_INTERFACE_SYNCHRONIZED_MODE, but it doesn't define COBJ_INTERFACE_WITH_SYNCHRONIZED"
+#	endif
+#	include "cobjpvt-generator-interface-synchronized.h"
+#endif
+
 // cleanup dynamic names
 #undef geninterface_mt
 #undef geninterface_mt_struct
 #undef geninterface_reference
 #undef geninterface_descriptor
+#undef geninterface_method_descriptors
+#undef geninterface_base_mt
+#undef geninterface_base_reference
+#undef geninterface_as_base
+#undef geninterface_proxy
+#undef geninterface_proxy_initialize
+#undef geninterface_stub_dispatch
+#undef geninterface_stub_serve
+#undef geninterface_shared
+#undef geninterface_shared_set
+#undef geninterface_resolve
+#undef geninterface_recorder
+#undef geninterface_recorder_initialize
+#undef geninterface_replay_dispatch
+#undef geninterface_replay
+#undef geninterface_memo
+#undef geninterface_memo_initialize
+#undef geninterface_memo_invalidate
+#undef geninterface_cmdbuf
+#undef geninterface_cmdbuf_initialize
+#undef geninterface_cmdbuf_execute
+#undef geninterface_cmdbuf_reset
+#undef geninterface_synchronized
+#undef geninterface_synchronized_initialize
+#undef geninterface_poly_for_each
+#undef COBJPVT_GEN_MEMO_KEY
+#undef COBJPVT_GEN_MEMO_ENTRY
+#undef COBJPVT_GEN_MEMO_CACHE
+#undef COBJPVT_GEN_MEMO_TYPES_0
+#undef COBJPVT_GEN_MEMO_TYPES_1
+#undef COBJPVT_GEN_MEMO_MEMBER_0
+#undef COBJPVT_GEN_MEMO_MEMBER_1
+#undef COBJPVT_GEN_ALL_METHOD_GENERATOR
+#undef COBJPVT_GEN_BASE_MT_INITIALIZER
+
+#undef COBJPVT_GEN_INTERFACE_AS_BASE
 
 // #undef properties passed
 #undef COBJ_INTERFACE_NAME
+#undef COBJ_INTERFACE_EXTENDS
+#undef COBJ_INTERFACE_INCLUDE_BASE
+#undef COBJ_INTERFACE_ASYNC_LOCALS
+#undef COBJ_INTERFACE_MEMO_SLOTS
+#undef COBJ_INTERFACE_WITH_REMOTE
+#undef COBJ_INTERFACE_WITH_SHARED
+#undef COBJ_INTERFACE_WITH_RECORD
+#undef COBJ_INTERFACE_WITH_MEMO
+#undef COBJ_INTERFACE_WITH_CMDBUF
+#undef COBJ_INTERFACE_WITH_SYNCHRONIZED
+#undef COBJ_INTERFACE_WITH_POLY
+#undef COBJ_INTERFACE_WITH_DELEGATES
 #undef COBJ_INTERFACE_METHODS
 
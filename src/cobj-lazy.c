@@ -0,0 +1,71 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "cobj-lazy.h"
+
+// returns immediately, if the state isn't value anymore
+static void lazy_futex_wait(atomic_int * word, int value)
+{
+	syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+static void lazy_futex_wake_all(atomic_int * word)
+{
+	syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, INT32_MAX, NULL, NULL, 0);
+}
+
+bool cobj_lazy_resolve_slow(cobj_lazy * lazy, const cobj_class_descriptor * class_descriptor, cobj_object * target, void * cold, const void * parameters)
+{
+	int state = cobj_lazy_state_uninitialized;
+	
+	if(atomic_compare_exchange_strong_explicit(&lazy->state, &state, cobj_lazy_state_initializing, memory_order_acquire, memory_order_acquire)){
+		state = class_descriptor->initialize(target, cold, parameters) ? cobj_lazy_state_initialized : cobj_lazy_state_failed;
+		
+		// the threads sleeping are woken, the others see the state without a syscall
+		if(atomic_exchange_explicit(&lazy->state, state, memory_order_release) == cobj_lazy_state_waiting){
+			lazy_futex_wake_all(&lazy->state);
+		}
+		
+		return state == cobj_lazy_state_initialized;
+	}
+	
+	// another thread is initializing it, this one sleeps until it's done
+	while(state == cobj_lazy_state_initializing || state == cobj_lazy_state_waiting){
+		if(state == cobj_lazy_state_waiting
+			|| atomic_compare_exchange_strong_explicit(&lazy->state, &state, cobj_lazy_state_waiting, memory_order_acquire, memory_order_acquire)){
+			lazy_futex_wait(&lazy->state, cobj_lazy_state_waiting);
+		}
+		
+		state = atomic_load_explicit(&lazy->state, memory_order_acquire);
+	}
+	
+	return state == cobj_lazy_state_initialized;
+}
@@ -0,0 +1,78 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef COBJ_LAZY_H_
+#define COBJ_LAZY_H_
+
+//////////////////////////////////////////////////////////////////////////
+// lazy initialization for classes defining COBJ_CLASS_LAZY
+//
+//	CLASS_lazy_initialize only stores the parameters, the object itself (the target)
+//	is initialized by the first method called on the proxy, or by CLASS_lazy_resolve.
+//	If several threads call the first method at the same time, one initializes the
+//	target, the others sleep until it's done (futex, Linux only). After that, each call
+//	only checks the state, and calls the thunk of the class directly.
+//
+//	The initializer is called once. If it failed, the state stays failed, resolving
+//	returns false, and the methods of the proxy return zero without calling the target.
+
+#include <stdatomic.h>
+
+#include "cobj.h"
+
+typedef enum cobj_lazy_state {
+	cobj_lazy_state_uninitialized,
+	cobj_lazy_state_initializing,
+	cobj_lazy_state_initialized,
+	cobj_lazy_state_failed,
+	
+	// initializing, and other threads sleep until it's done
+	cobj_lazy_state_waiting
+} cobj_lazy_state;
+
+typedef struct cobj_lazy {
+	atomic_int state;
+} cobj_lazy;
+
+static inline void cobj_lazy_initialize(cobj_lazy * lazy)
+{
+	atomic_init(&lazy->state, cobj_lazy_state_uninitialized);
+}
+
+// initializes the target by the generic initializer of the class, if no other thread did it.
+//	Returns false, if the initializer failed (now or before).
+bool cobj_lazy_resolve_slow(cobj_lazy * lazy, const cobj_class_descriptor * class_descriptor, cobj_object * target, void * cold, const void * parameters);
+
+static inline bool cobj_lazy_resolve(cobj_lazy * lazy, const cobj_class_descriptor * class_descriptor, cobj_object * target, void * cold, const void * parameters)
+{
+	if(atomic_load_explicit(&lazy->state, memory_order_acquire) == cobj_lazy_state_initialized){
+		return true;
+	}
+	
+	return cobj_lazy_resolve_slow(lazy, class_descriptor, target, cold, parameters);
+}
+
+#endif /* COBJ_LAZY_H_ */
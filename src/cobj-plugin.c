@@ -0,0 +1,136 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include <string.h>
+#include <sched.h>
+#include <dlfcn.h>
+
+#include "cobj-plugin.h"
+
+// the registered libraries, new ones are pushed to the front
+static cobj_plugin_library * _Atomic libraries;
+
+static void plugin_push(cobj_plugin_library * library)
+{
+	cobj_plugin_library * head = atomic_load_explicit(&libraries, memory_order_relaxed);
+	
+	do {
+		atomic_store_explicit(&library->next, head, memory_order_relaxed);
+	} while(!atomic_compare_exchange_weak_explicit(&libraries, &head, library, memory_order_release, memory_order_relaxed));
+}
+
+void cobj_plugin_add_library(cobj_plugin_library * library, const char * path)
+{
+	library->path = path;
+	library->plugin = NULL;
+	library->handle = NULL;
+	atomic_init(&library->state, cobj_plugin_state_unloaded);
+	
+	plugin_push(library);
+}
+
+void cobj_plugin_add_table(cobj_plugin_library * library, const cobj_plugin * plugin)
+{
+	library->path = NULL;
+	library->plugin = plugin;
+	library->handle = NULL;
+	atomic_init(&library->state, cobj_plugin_state_loaded);
+	
+	plugin_push(library);
+}
+
+static bool plugin_is_compatible(const cobj_plugin * plugin)
+{
+	return plugin->abi_version == COBJ_PLUGIN_ABI_VERSION
+		&& plugin->descriptor_size == sizeof(cobj_class_descriptor);
+}
+
+// loads the library, if it's not loaded, and no other thread loads it. Returns the final state.
+static cobj_plugin_state plugin_load(cobj_plugin_library * library)
+{
+	int state = cobj_plugin_state_unloaded;
+	
+	if(atomic_compare_exchange_strong_explicit(&library->state, &state, cobj_plugin_state_loading, memory_order_acquire, memory_order_acquire)){
+		library->handle = dlopen(library->path, RTLD_NOW | RTLD_LOCAL);
+		library->plugin = library->handle ? (const cobj_plugin *)dlsym(library->handle, COBJ_PLUGIN_SYMBOL) : NULL;
+		
+		if(!library->plugin || !plugin_is_compatible(library->plugin)){
+			library->plugin = NULL;
+			state = cobj_plugin_state_failed;
+		} else {
+			state = cobj_plugin_state_loaded;
+		}
+		
+		atomic_store_explicit(&library->state, state, memory_order_release);
+		return (cobj_plugin_state)state;
+	}
+	
+	// another thread is loading it
+	while(state == cobj_plugin_state_loading){
+		sched_yield();
+		state = atomic_load_explicit(&library->state, memory_order_acquire);
+	}
+	
+	return (cobj_plugin_state)state;
+}
+
+static const cobj_class_descriptor * plugin_find(const cobj_plugin * plugin, const char * class_name)
+{
+	for(size_t i = 0; i < plugin->class_count; i++){
+		if(strcmp(plugin->classes[i]->class_name, class_name) == 0){
+			return plugin->classes[i];
+		}
+	}
+	
+	return NULL;
+}
+
+const cobj_class_descriptor * cobj_plugin_find_class(const char * class_name)
+{
+	cobj_plugin_library * head = atomic_load_explicit(&libraries, memory_order_acquire);
+	
+	// the libraries already loaded first, so no library is loaded without need
+	for(cobj_plugin_library * library = head; library; library = atomic_load_explicit(&library->next, memory_order_relaxed)){
+		if(atomic_load_explicit(&library->state, memory_order_acquire) == cobj_plugin_state_loaded){
+			const cobj_class_descriptor * descriptor = plugin_find(library->plugin, class_name);
+			if(descriptor){
+				return descriptor;
+			}
+		}
+	}
+	
+	for(cobj_plugin_library * library = head; library; library = atomic_load_explicit(&library->next, memory_order_relaxed)){
+		// libraries loaded by other threads meanwhile are searched too
+		if(plugin_load(library) == cobj_plugin_state_loaded){
+			const cobj_class_descriptor * descriptor = plugin_find(library->plugin, class_name);
+			if(descriptor){
+				return descriptor;
+			}
+		}
+	}
+	
+	return NULL;
+}
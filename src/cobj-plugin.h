@@ -0,0 +1,112 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef COBJ_PLUGIN_H_
+#define COBJ_PLUGIN_H_
+
+//////////////////////////////////////////////////////////////////////////
+// classes in plugins (shared objects), loaded on first use
+//
+//	A plugin exports a table of class-descriptors, in one of it's .c files:
+//
+//	#include "cobj-plugin.h"
+//	#include "classes/gpio_pin_inverter.h"
+//
+//	COBJ_PLUGIN_EXPORT(&gpio_pin_inverter_descriptor_instance);
+//
+//	The interfaces stay in the interface-registry of the program, which is linked with
+//	-rdynamic, so the plugin uses the same descriptors. The program registers the plugins
+//	it may need, they are loaded when a class of them is looked up the first time:
+//
+//	static cobj_plugin_library drivers;
+//	cobj_plugin_add_library(&drivers, "./drivers.so");
+//
+//	const cobj_class_descriptor * class_descriptor = cobj_plugin_find_class("gpio_pin_inverter");
+//
+//	The objects are created with the size and the initializer of the descriptor, the
+//	parameters are passed as CLASS_parameters struct. The plugin has been compiled with
+//	the interfaces of the time it was built: queryinterface fails, if an interface has
+//	more methods now.
+//
+//	The entries of the registry are provided by the caller, and are never removed. Adding and
+//	finding classes is lock-free, so it may be done by any thread. Link with -ldl.
+
+#include <stdatomic.h>
+
+#include "cobj.h"
+
+// changes, when cobj_plugin or cobj_class_descriptor change incompatible
+#define COBJ_PLUGIN_ABI_VERSION	1
+
+// the name of the table exported by a plugin
+#define COBJ_PLUGIN_SYMBOL	"cobj_plugin_table"
+
+typedef struct cobj_plugin {
+	unsigned int abi_version;
+	size_t descriptor_size;
+	
+	const cobj_class_descriptor * const * classes;
+	size_t class_count;
+} cobj_plugin;
+
+#define COBJ_PLUGIN_EXPORT(...)	\
+	static const cobj_class_descriptor * const cobj_plugin_classes[] = { __VA_ARGS__ };	\
+	const cobj_plugin cobj_plugin_table = {	\
+		.abi_version = COBJ_PLUGIN_ABI_VERSION,	\
+		.descriptor_size = sizeof(cobj_class_descriptor),	\
+		.classes = cobj_plugin_classes,	\
+		.class_count = sizeof(cobj_plugin_classes) / sizeof(cobj_plugin_classes[0])	\
+	}
+
+typedef enum cobj_plugin_state {
+	cobj_plugin_state_unloaded,
+	cobj_plugin_state_loading,
+	cobj_plugin_state_loaded,
+	cobj_plugin_state_failed
+} cobj_plugin_state;
+
+typedef struct cobj_plugin_library {
+	const char * path;
+	
+	// the table, set before the state becomes cobj_plugin_state_loaded
+	const cobj_plugin * plugin;
+	void * handle;
+	atomic_int state;
+	
+	struct cobj_plugin_library * _Atomic next;
+} cobj_plugin_library;
+
+// registers the shared object at path, it's loaded when a class is looked up
+void cobj_plugin_add_library(cobj_plugin_library * library, const char * path);
+
+// registers a table linked into the program, like a plugin already loaded
+void cobj_plugin_add_table(cobj_plugin_library * library, const cobj_plugin * plugin);
+
+// returns the descriptor of the class, or null. The plugins are loaded until the class is found.
+const cobj_class_descriptor * cobj_plugin_find_class(const char * class_name);
+
+
+#endif /* COBJ_PLUGIN_H_ */
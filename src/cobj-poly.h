@@ -0,0 +1,242 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+#ifndef COBJ_POLY_H_
+#define COBJ_POLY_H_
+
+//////////////////////////////////////////////////////////////////////////
+// polymorphic collections: objects of different classes, stored in a segment per class
+//
+//	Calling a method on an array of references to mixed classes jumps between the mts, and
+//	the objects are spread over the memory. A collection stores the objects themselves,
+//	packed in a segment for each class, so they are iterated one class after the other:
+//
+//	static cobj_poly_segment segments[2];
+//	static _Alignas(hw_gpio_pin) unsigned char hw_pins[16 * sizeof(hw_gpio_pin)];
+//	static _Alignas(gpio_pin_inverter) unsigned char inverters[16 * sizeof(gpio_pin_inverter)];
+//
+//	cobj_poly_collection pins;
+//	cobj_poly_initialize(&pins, segments, 2);
+//	cobj_poly_add_segment(&pins, hw_gpio_pin_descriptor, hw_pins, sizeof(hw_pins));
+//	cobj_poly_add_segment(&pins, gpio_pin_inverter_descriptor, inverters, sizeof(inverters));
+//
+//	hw_gpio_pin * pin = (hw_gpio_pin *)cobj_poly_reserve(&pins, hw_gpio_pin_descriptor);
+//	if(pin && hw_gpio_pin_initialize(pin, ...)){
+//		cobj_poly_commit(&pins, &pin->object);
+//	}
+//	...
+//	COBJ_POLY_FOR_EACH(&pins, gpio_pin, &toggle_pin, NULL);
+//
+//	Each interface generates INTERFACE_poly_for_each (used by COBJ_POLY_FOR_EACH), which calls
+//	queryinterface once per segment, and the function with a reference to each object of it.
+//	So the calls of a segment use the same mt, and the objects are read sequentially.
+//	Segments of classes not implementing the interface are skipped. COBJ_POLY_FOR_EACH_REFERENCE
+//	does the same with an inline body.
+//
+//	The segments and their memory are provided by the caller. Erasing an object moves the last
+//	object of it's segment to it's place by memcpy. So the objects must not be referenced by their
+//	address while objects are erased, and a class must not hold pointers to it's own object (like
+//	an intrusive list, or a subscription passing the object). Objects are not finalized.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "cobj.h"
+
+typedef struct cobj_poly_segment {
+	const cobj_class_descriptor * class_descriptor;
+	
+	// the objects, each class_descriptor->object_size bytes
+	unsigned char * memory;
+	size_t count;
+	size_t capacity;
+} cobj_poly_segment;
+
+typedef struct cobj_poly_collection {
+	cobj_poly_segment * segments;
+	size_t segments_count;
+	size_t segments_capacity;
+} cobj_poly_collection;
+
+static inline void cobj_poly_initialize(cobj_poly_collection * collection, cobj_poly_segment * segments, size_t segments_capacity)
+{
+	collection->segments = segments;
+	collection->segments_count = 0;
+	collection->segments_capacity = segments_capacity;
+}
+
+// the segment of the class, or null
+static inline cobj_poly_segment * cobj_poly_find_segment(const cobj_poly_collection * collection, const cobj_class_descriptor * class_descriptor)
+{
+	for(size_t i = 0; i < collection->segments_count; i++){
+		if(collection->segments[i].class_descriptor == class_descriptor){
+			return &collection->segments[i];
+		}
+	}
+	
+	return (cobj_poly_segment *)0;
+}
+
+// adds the segment of the class, the memory has to be aligned for the objects of the class.
+//	Returns false, if the class has a segment already, or there are no more segments.
+static inline bool cobj_poly_add_segment(cobj_poly_collection * collection, const cobj_class_descriptor * class_descriptor, void * memory, size_t size)
+{
+	if(collection->segments_count == collection->segments_capacity
+		|| cobj_poly_find_segment(collection, class_descriptor)
+		|| (uintptr_t)memory % class_descriptor->object_alignment){
+		return false;
+	}
+	
+	cobj_poly_segment * segment = &collection->segments[collection->segments_count++];
+	segment->class_descriptor = class_descriptor;
+	segment->memory = (unsigned char *)memory;
+	segment->count = 0;
+	segment->capacity = size / class_descriptor->object_size;
+	
+	return true;
+}
+
+// returns the zero-initialized memory of a new object of the class, which is initialized by CLASS_initialize.
+//	It's not part of the collection until cobj_poly_commit, so a failed initialize doesn't leave an object
+//	behind. The next reserve of the class returns the same memory. Returns null, if the class has no segment,
+//	or it's segment is full.
+static inline cobj_object * cobj_poly_reserve(cobj_poly_collection * collection, const cobj_class_descriptor * class_descriptor)
+{
+	cobj_poly_segment * segment = cobj_poly_find_segment(collection, class_descriptor);
+	
+	if(!segment || segment->count == segment->capacity){
+		return (cobj_object *)0;
+	}
+	
+	cobj_object * object = (cobj_object *)(segment->memory + segment->count * class_descriptor->object_size);
+	memset(object, 0, class_descriptor->object_size);
+	
+	return object;
+}
+
+// adds the object returned by cobj_poly_reserve, after it was initialized
+static inline void cobj_poly_commit(cobj_poly_collection * collection, cobj_object * object)
+{
+	cobj_poly_find_segment(collection, object->class_descriptor)->count++;
+}
+
+// reserves, initializes (by the descriptor, see cobj_class_descriptor) and commits a new object of the class.
+//	Returns null, if there is no memory, or the initialize failed.
+static inline cobj_object * cobj_poly_insert(cobj_poly_collection * collection, const cobj_class_descriptor * class_descriptor, void * cold, const void * parameters)
+{
+	cobj_object * object = cobj_poly_reserve(collection, class_descriptor);
+	
+	if(!object || !class_descriptor->initialize(object, cold, parameters)){
+		return (cobj_object *)0;
+	}
+	
+	cobj_poly_commit(collection, object);
+	return object;
+}
+
+// removes the object, the last object of the segment is moved to it's place (by memcpy, see above).
+//	Returns false, if the object is not in the collection.
+static inline bool cobj_poly_erase(cobj_poly_collection * collection, cobj_object * object)
+{
+	cobj_poly_segment * segment = cobj_poly_find_segment(collection, object->class_descriptor);
+	size_t object_size = object->class_descriptor->object_size;
+	
+	// compared as integers, the object may be in another array
+	if(!segment
+		|| (uintptr_t)object < (uintptr_t)segment->memory
+		|| (uintptr_t)object >= (uintptr_t)(segment->memory + segment->count * object_size)){
+		return false;
+	}
+	
+	unsigned char * last = segment->memory + --segment->count * object_size;
+	if((unsigned char *)object != last){
+		memcpy(object, last, object_size);
+	}
+	
+	return true;
+}
+
+static inline size_t cobj_poly_count(const cobj_poly_collection * collection)
+{
+	size_t count = 0;
+	
+	for(size_t i = 0; i < collection->segments_count; i++){
+		count += collection->segments[i].count;
+	}
+	
+	return count;
+}
+
+// removes all objects, the segments are kept
+static inline void cobj_poly_clear(cobj_poly_collection * collection)
+{
+	for(size_t i = 0; i < collection->segments_count; i++){
+		collection->segments[i].count = 0;
+	}
+}
+
+// the objects of a segment, and the mt of the interface for them. The mt is null, if the class
+//	doesn't implement the interface, or the segment is empty.
+typedef struct cobj_poly_range {
+	cobj_mt mt;
+	unsigned char * begin;
+	unsigned char * end;
+	size_t object_size;
+} cobj_poly_range;
+
+static inline cobj_poly_range cobj_poly_segment_range(const cobj_poly_segment * segment, const cobj_interface_descriptor * interface)
+{
+	cobj_poly_range range;
+	range.mt = segment->count ? segment->class_descriptor->queryinterface(interface) : (cobj_mt)0;
+	range.object_size = segment->class_descriptor->object_size;
+	range.begin = segment->memory;
+	range.end = segment->memory + segment->count * range.object_size;
+	
+	return range;
+}
+
+// calls GEN_FUNCTION(const INTERFACE * reference, void * context) for each object implementing the interface
+#define COBJ_POLY_FOR_EACH(GEN_COLLECTION, GEN_INTERFACE_NAME, GEN_FUNCTION, GEN_CONTEXT)	\
+	COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _poly_for_each)(GEN_COLLECTION, GEN_FUNCTION, GEN_CONTEXT)
+
+// runs the following statement for each object implementing the interface, with the reference
+//	INTERFACE GEN_REFERENCE to it. The mt is loaded once per segment. A break leaves the objects
+//	of the current segment only.
+//
+//	COBJ_POLY_FOR_EACH_REFERENCE(&pins, gpio_pin, pin) {
+//		gpio_pin_toggle(&pin);
+//	}
+#define COBJ_POLY_FOR_EACH_REFERENCE(GEN_COLLECTION, GEN_INTERFACE_NAME, GEN_REFERENCE)	\
+	for(size_t cobjpvt_poly_segment = 0; cobjpvt_poly_segment < (GEN_COLLECTION)->segments_count; cobjpvt_poly_segment++)	\
+		for(cobj_poly_range cobjpvt_poly_range = cobj_poly_segment_range(&(GEN_COLLECTION)->segments[cobjpvt_poly_segment], COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _descriptor));	\
+			cobjpvt_poly_range.mt; cobjpvt_poly_range.mt = (cobj_mt)0)	\
+			for(GEN_INTERFACE_NAME GEN_REFERENCE = { (COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _mt) *)cobjpvt_poly_range.mt, (cobj_object *)cobjpvt_poly_range.begin };	\
+				(unsigned char *)GEN_REFERENCE.object < cobjpvt_poly_range.end;	\
+				GEN_REFERENCE.object = (cobj_object *)((unsigned char *)GEN_REFERENCE.object + cobjpvt_poly_range.object_size))
+
+
+#endif /* COBJ_POLY_H_ */
@@ -0,0 +1,104 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include <stdio.h>
+
+#include "cobj-profile.h"
+
+// the list of all sites called at least once
+static cobj_profile_site * _Atomic profile_sites;
+
+static void profile_register(cobj_profile_site * site)
+{
+	if(atomic_exchange_explicit(&site->registered, true, memory_order_relaxed)){
+		return;
+	}
+	
+	cobj_profile_site * head = atomic_load_explicit(&profile_sites, memory_order_relaxed);
+	do {
+		site->next = head;
+	} while(!atomic_compare_exchange_weak_explicit(&profile_sites, &head, site, memory_order_release, memory_order_relaxed));
+}
+
+void cobj_profile_record(cobj_profile_site * site, const cobj_object * object)
+{
+	const cobj_class_descriptor * class_descriptor = object->class_descriptor;
+	
+	profile_register(site);
+	
+	for(int i = 0; i < COBJ_PROFILE_SITE_CLASSES; i++){
+		const cobj_class_descriptor * slot = atomic_load_explicit(&site->classes[i].class_descriptor, memory_order_relaxed);
+		
+		// claim a free slot for this class. If another thread was faster, slot is updated to it's class
+		if(!slot && atomic_compare_exchange_strong_explicit(&site->classes[i].class_descriptor, &slot, class_descriptor, memory_order_relaxed, memory_order_relaxed)){
+			slot = class_descriptor;
+		}
+		
+		if(slot == class_descriptor){
+			atomic_fetch_add_explicit(&site->classes[i].calls, 1, memory_order_relaxed);
+			return;
+		}
+	}
+	
+	atomic_fetch_add_explicit(&site->other_calls, 1, memory_order_relaxed);
+}
+
+bool cobj_profile_write(const char * filename, unsigned min_percent)
+{
+	FILE * file = fopen(filename, "w");
+	if(!file){
+		return false;
+	}
+	
+	fprintf(file, "// cobj profile, written by cobj_profile_write\n");
+	fprintf(file, "//	include it before the interfaces are generated, see cobj-profile.h\n\n");
+	
+	for(cobj_profile_site * site = atomic_load_explicit(&profile_sites, memory_order_acquire); site; site = site->next){
+		unsigned long total = atomic_load_explicit(&site->other_calls, memory_order_relaxed);
+		unsigned long dominant_calls = 0;
+		const cobj_class_descriptor * dominant = NULL;
+		
+		for(int i = 0; i < COBJ_PROFILE_SITE_CLASSES; i++){
+			const cobj_class_descriptor * class_descriptor = atomic_load_explicit(&site->classes[i].class_descriptor, memory_order_relaxed);
+			unsigned long calls = atomic_load_explicit(&site->classes[i].calls, memory_order_relaxed);
+			
+			total += calls;
+			if(class_descriptor && calls > dominant_calls){
+				dominant = class_descriptor;
+				dominant_calls = calls;
+			}
+		}
+		
+		fprintf(file, "// %s_%s: %s %lu of %lu calls\n", site->interface_name, site->method_name,
+			dominant ? dominant->class_name : "-", dominant_calls, total);
+		
+		if(dominant && dominant_calls * 100 >= (unsigned long)min_percent * total){
+			fprintf(file, "#define COBJ_PROFILE_%s_%s\t(%s)\n", site->interface_name, site->method_name, dominant->class_name);
+		}
+	}
+	
+	return fclose(file) == 0;
+}
@@ -0,0 +1,90 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef COBJ_PROFILE_H_
+#define COBJ_PROFILE_H_
+
+//////////////////////////////////////////////////////////////////////////
+// profile-guided devirtualization of interface calls
+//
+//	Many references are dynamically monomorphic: console_vprintf is almost always
+//	called on a stdconsole, but the generator can't know that. So it's done in two phases:
+//
+//	(1) The interface-registry is compiled with COBJ_PROFILE_GENERATE defined, and cobj-profile.c
+//		is linked. Each interface method counts the classes it's called on. At the end
+//		of a representative run, cobj_profile_write writes the profile:
+//
+//		#define COBJ_PROFILE_console_vprintf	(stdconsole)
+//
+//	(2) The profile is included before any interface is generated (e.g. gcc -include cobj-profile-demo.h).
+//		For each method named in the profile, the interface generator emits a static inline method,
+//		which calls the thunk of the class directly if the reference uses it, and calls
+//		the method-table otherwise:
+//
+//		if(reference->mt->vprintf == &stdconsole_console_vprintf_thunk)
+//			return stdconsole_console_vprintf_thunk(reference->object, string, vlist);
+//		else
+//			return reference->mt->vprintf(reference->object, string, vlist);
+//
+//		The direct call is predicted, and may be inlined by link-time optimization.
+//		References of other classes still work, they take the indirect call. The thunks
+//		of the classes are static, only those of the methods named in the profile are exported.
+//
+//	The profile is kept per interface method, not per call site: the interface methods are
+//	functions of the registry, so all calls of a method share the same guarded fast path.
+
+#include <stdatomic.h>
+
+#include "cobj.h"
+
+// number of different classes counted per method, others are summed up
+#define COBJ_PROFILE_SITE_CLASSES	4
+
+typedef struct cobj_profile_site {
+	cobj_descriptor_string interface_name;
+	cobj_descriptor_string method_name;
+	
+	// sites are registered on their first call
+	struct cobj_profile_site * next;
+	atomic_bool registered;
+	
+	struct {
+		const cobj_class_descriptor * _Atomic class_descriptor;
+		atomic_ulong calls;
+	} classes[COBJ_PROFILE_SITE_CLASSES];
+	
+	atomic_ulong other_calls;
+	
+} cobj_profile_site;
+
+// counts a call to the site on the object. This is called by the interface-registry.
+void cobj_profile_record(cobj_profile_site * site, const cobj_object * object);
+
+// writes the profile to filename. A method is devirtualized, if a single class
+//	receives at least min_percent of it's calls.
+bool cobj_profile_write(const char * filename, unsigned min_percent);
+
+#endif /* COBJ_PROFILE_H_ */
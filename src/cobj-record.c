@@ -0,0 +1,214 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+
+#include "cobj-record.h"
+
+uint64_t cobj_record_now(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+bool cobj_record_open(cobj_record_writer * writer, const char * path, const char * interface_name)
+{
+	cobj_record_file_header header;
+	
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, COBJ_RECORD_MAGIC, sizeof(header.magic));
+	strncpy(header.interface_name, interface_name, sizeof(header.interface_name) - 1);
+	
+	writer->file = fopen(path, "wb");
+	writer->start = cobj_record_now();
+	
+	if(!writer->file){
+		return false;
+	}
+	
+	if(fwrite(&header, sizeof(header), 1, writer->file) != 1){
+		fclose(writer->file);
+		writer->file = NULL;
+		return false;
+	}
+	
+	return true;
+}
+
+void cobj_record_close(cobj_record_writer * writer)
+{
+	if(writer->file){
+		fclose(writer->file);
+		writer->file = NULL;
+	}
+}
+
+void cobj_record_write(cobj_record_writer * writer, cobj_record_header * record, uint32_t method, size_t size, uint64_t start)
+{
+	record->method = method;
+	record->size = (uint32_t)size;
+	record->time = start - writer->start;
+	record->duration = cobj_record_now() - start;
+	
+	// the file is buffered, so this is a copy most of the time
+	if(writer->file){
+		fwrite(record, size, 1, writer->file);
+	}
+}
+
+static void record_wait_until(uint64_t time)
+{
+	struct timespec until = {
+		.tv_sec = (time_t)(time / 1000000000u),
+		.tv_nsec = (long)(time % 1000000000u)
+	};
+	
+	// continue if interrupted by a signal. Other errors can't be solved by trying again, so the call isn't delayed.
+	while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &until, NULL) == EINTR){
+	}
+}
+
+static void record_stats_add(cobj_record_stats * stats, uint64_t latency)
+{
+	unsigned int bucket = 0;
+	
+	while(bucket < COBJ_RECORD_BUCKETS - 1 && latency >= ((uint64_t)1 << bucket)){
+		bucket++;
+	}
+	
+	stats->calls++;
+	stats->buckets[bucket]++;
+	
+	if(latency > stats->max){
+		stats->max = latency;
+	}
+}
+
+bool cobj_record_replay(const char * path, const char * interface_name, cobj_record_dispatch dispatch, const void * target, bool paced, cobj_record_stats * stats)
+{
+	cobj_record_file_header header;
+	union {
+		max_align_t align;
+		unsigned char bytes[COBJ_RECORD_MAX_SIZE];
+	} buffer;
+	cobj_record_header * record = (cobj_record_header *)buffer.bytes;
+	bool result = true;
+	
+	memset(stats, 0, sizeof(*stats));
+	
+	FILE * file = fopen(path, "rb");
+	if(!file){
+		return false;
+	}
+	
+	if(fread(&header, sizeof(header), 1, file) != 1
+		|| memcmp(header.magic, COBJ_RECORD_MAGIC, sizeof(header.magic)) != 0
+		|| strncmp(header.interface_name, interface_name, sizeof(header.interface_name)) != 0){
+		fclose(file);
+		return false;
+	}
+	
+	uint64_t start = cobj_record_now();
+	
+	for(;;){
+		size_t header_size = fread(record, 1, sizeof(cobj_record_header), file);
+		
+		if(header_size == 0 && feof(file)){
+			break;
+		}
+		
+		size_t arguments_size = record->size - sizeof(cobj_record_header);
+		
+		if(header_size != sizeof(cobj_record_header)
+			|| record->size < sizeof(cobj_record_header) || record->size > sizeof(buffer)
+			|| (arguments_size && fread(record + 1, arguments_size, 1, file) != 1)){
+			// truncated or corrupted
+			result = false;
+			break;
+		}
+		
+		if(paced){
+			record_wait_until(start + record->time);
+		}
+		
+		uint64_t call = cobj_record_now();
+		if(!dispatch(target, record)){
+			result = false;
+			break;
+		}
+		
+		record_stats_add(stats, cobj_record_now() - call);
+	}
+	
+	stats->elapsed = cobj_record_now() - start;
+	fclose(file);
+	
+	return result;
+}
+
+uint64_t cobj_record_stats_percentile(const cobj_record_stats * stats, double fraction)
+{
+	uint64_t needed = (uint64_t)(fraction * (double)stats->calls);
+	
+	// rounded up, so it's the latency of a call
+	if((double)needed < fraction * (double)stats->calls || needed == 0){
+		needed++;
+	}
+	uint64_t counted = 0;
+	
+	for(unsigned int bucket = 0; bucket < COBJ_RECORD_BUCKETS; bucket++){
+		counted += stats->buckets[bucket];
+		
+		if(counted >= needed){
+			return (uint64_t)1 << bucket;
+		}
+	}
+	
+	return stats->max;
+}
+
+void cobj_record_stats_print(const cobj_record_stats * stats, FILE * file)
+{
+	double seconds = (double)stats->elapsed / 1e9;
+	
+	fprintf(file, "calls: %llu in %.3f s (%.0f calls/s)\n",
+		(unsigned long long)stats->calls, seconds, seconds > 0 ? (double)stats->calls / seconds : 0.0);
+	fprintf(file, "latency (ns): p50 < %llu, p90 < %llu, p99 < %llu, p99.9 < %llu, max %llu\n",
+		(unsigned long long)cobj_record_stats_percentile(stats, 0.5),
+		(unsigned long long)cobj_record_stats_percentile(stats, 0.9),
+		(unsigned long long)cobj_record_stats_percentile(stats, 0.99),
+		(unsigned long long)cobj_record_stats_percentile(stats, 0.999),
+		(unsigned long long)stats->max);
+	
+	for(unsigned int bucket = 0; bucket < COBJ_RECORD_BUCKETS; bucket++){
+		if(stats->buckets[bucket]){
+			fprintf(file, "  < %12llu ns: %llu\n", (unsigned long long)1 << bucket, (unsigned long long)stats->buckets[bucket]);
+		}
+	}
+}
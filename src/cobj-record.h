@@ -0,0 +1,123 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef COBJ_RECORD_H_
+#define COBJ_RECORD_H_
+
+//////////////////////////////////////////////////////////////////////////
+// recording of the calls to an interface, and replay of them to another class
+//
+//	The interfaces are generated in COBJ_INTERFACE_RECORD_MODE once (like in the interface-registry),
+//	which generates a recorder class and a replay function for them. The recorder decorates a
+//	reference, each call is forwarded and written into the file, with the time and the duration:
+//
+//	cobj_record_writer writer;
+//	cobj_record_open(&writer, "gpio_pin.rec", "gpio_pin");
+//
+//	gpio_pin_recorder recorder;
+//	gpio_pin_recorder_initialize(&recorder, &production_pin, &writer);
+//	gpio_pin_queryinterface(&recorder.object, &application_resources.output_pin);
+//	...
+//	cobj_record_close(&writer);
+//
+//	The calls are replayed to a reference of any class, as fast as possible, or at the pace they
+//	were recorded. The throughput and the latencies of the calls are returned:
+//
+//	cobj_record_stats stats;
+//	gpio_pin_replay("gpio_pin.rec", &candidate_pin, false, &stats);
+//	cobj_record_stats_print(&stats, stdout);
+//
+//	The arguments are written as they are, so pointers are not valid when they are replayed.
+//	Record interfaces taking their arguments by value. A writer is used by one thread.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "cobj.h"
+
+#define COBJ_RECORD_MAGIC	"COBJREC1"
+
+// the largest record (the arguments of a method) a file may contain
+#ifndef COBJ_RECORD_MAX_SIZE
+#	define COBJ_RECORD_MAX_SIZE	1024
+#endif
+
+// the file starts with this header
+typedef struct cobj_record_file_header {
+	char magic[8];
+	char interface_name[56];
+} cobj_record_file_header;
+
+// the first member of each record. The size includes the header.
+typedef struct cobj_record_header {
+	uint32_t method;
+	uint32_t size;
+	
+	// nanoseconds since the file was opened, and the duration of the call in the recorded process
+	uint64_t time;
+	uint64_t duration;
+} cobj_record_header;
+
+typedef struct cobj_record_writer {
+	FILE * file;
+	uint64_t start;
+} cobj_record_writer;
+
+// a log2 histogram of the latencies: bucket i counts the calls taking less than 2^i nanoseconds
+#define COBJ_RECORD_BUCKETS	40
+
+typedef struct cobj_record_stats {
+	uint64_t calls;
+	uint64_t elapsed;
+	uint64_t max;
+	uint64_t buckets[COBJ_RECORD_BUCKETS];
+} cobj_record_stats;
+
+// the replay function of an interface, target points to the reference of the interface
+typedef bool (* cobj_record_dispatch)(const void * target, const cobj_record_header * record);
+
+// the monotonic time in nanoseconds
+uint64_t cobj_record_now(void);
+
+bool cobj_record_open(cobj_record_writer * writer, const char * path, const char * interface_name);
+void cobj_record_close(cobj_record_writer * writer);
+
+// writes the record of a call started at start (by cobj_record_now)
+void cobj_record_write(cobj_record_writer * writer, cobj_record_header * record, uint32_t method, size_t size, uint64_t start);
+
+// replays the file to the dispatch function. paced waits for the time of each record, else
+// the calls are made as fast as possible. Fails, if the file was recorded for another interface.
+bool cobj_record_replay(const char * path, const char * interface_name, cobj_record_dispatch dispatch, const void * target, bool paced, cobj_record_stats * stats);
+
+// returns the upper bound of the latency of the given fraction of the calls (like 0.99)
+uint64_t cobj_record_stats_percentile(const cobj_record_stats * stats, double fraction);
+
+// prints the throughput and the distribution of the latencies
+void cobj_record_stats_print(const cobj_record_stats * stats, FILE * file);
+
+
+#endif /* COBJ_RECORD_H_ */
@@ -0,0 +1,196 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "cobj-refcount.h"
+
+#include <pthread.h>
+
+_Thread_local cobj_refcount_queue * cobj_refcount_current;
+
+static cobj_refcount_queue refcount_queues[COBJ_REFCOUNT_THREADS];
+
+// the owner of objects initialized while the pool is empty, they are merged and never queued
+static cobj_refcount_queue refcount_unowned;
+
+static pthread_once_t refcount_once = PTHREAD_ONCE_INIT;
+static pthread_key_t refcount_key;
+
+// the count of a shared value, the flags are never negative
+#define REFCOUNT_COUNT(shared)	(((shared) - ((shared) & (COBJ_REFCOUNT_ONE - 1))) / COBJ_REFCOUNT_ONE)
+
+static void refcount_finalize(cobj_refcount * refcount)
+{
+	cobj_object * object = (cobj_object *)((char *)refcount - offsetof(cobj_object, object_data));
+	object->class_descriptor->finalize(object);
+}
+
+static void refcount_enqueue(cobj_refcount * refcount)
+{
+	cobj_refcount_queue * queue = refcount->owner;
+	cobj_refcount * head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+	
+	do {
+		refcount->next = head;
+	} while(!atomic_compare_exchange_weak_explicit(&queue->head, &head, refcount, memory_order_release, memory_order_relaxed));
+}
+
+// returns the queue to the pool when the thread exits. The next thread taking it owns the objects.
+static void refcount_thread_exit(void * queue)
+{
+	cobj_refcount_flush();
+	cobj_refcount_current = NULL;
+	atomic_store_explicit(&((cobj_refcount_queue *)queue)->used, false, memory_order_release);
+}
+
+static void refcount_key_create(void)
+{
+	pthread_key_create(&refcount_key, refcount_thread_exit);
+}
+
+// takes a free queue from the pool, or returns null if there is none
+static cobj_refcount_queue * refcount_queue_take(void)
+{
+	pthread_once(&refcount_once, refcount_key_create);
+	
+	for(size_t i = 0; i < COBJ_REFCOUNT_THREADS; ++i){
+		bool used = false;
+		
+		// acquire the objects of the previous owner
+		if(atomic_compare_exchange_strong_explicit(&refcount_queues[i].used, &used, true, memory_order_acquire, memory_order_relaxed)){
+			cobj_refcount_current = &refcount_queues[i];
+			
+			if(pthread_setspecific(refcount_key, cobj_refcount_current)){
+				cobj_refcount_current = NULL;
+				atomic_store_explicit(&refcount_queues[i].used, false, memory_order_release);
+				return NULL;
+			}
+			
+			// objects queued after the previous owner exited
+			cobj_refcount_flush();
+			return cobj_refcount_current;
+		}
+	}
+	
+	return NULL;
+}
+
+void cobj_refcount_initialize(cobj_refcount * refcount)
+{
+	refcount->next = NULL;
+	
+	if(cobj_refcount_current || refcount_queue_take()){
+		refcount->owner = cobj_refcount_current;
+		refcount->biased = 1;
+		refcount->merged = false;
+		atomic_init(&refcount->shared, 0);
+	} else {
+		refcount->owner = &refcount_unowned;
+		refcount->biased = 0;
+		refcount->merged = true;
+		atomic_init(&refcount->shared, COBJ_REFCOUNT_ONE | COBJ_REFCOUNT_MERGED);
+	}
+}
+
+void cobj_refcount_retain_shared(cobj_refcount * refcount)
+{
+	if(!refcount->owner){
+		return;
+	}
+	
+	atomic_fetch_add_explicit(&refcount->shared, COBJ_REFCOUNT_ONE, memory_order_relaxed);
+}
+
+void cobj_refcount_release_shared(cobj_refcount * refcount)
+{
+	if(!refcount->owner){
+		return;
+	}
+	
+	intptr_t old = atomic_load_explicit(&refcount->shared, memory_order_relaxed);
+	intptr_t new;
+	
+	do {
+		new = old - COBJ_REFCOUNT_ONE;
+		
+		// we released a reference of the owner, it needs to merge the counts
+		if(!(old & (COBJ_REFCOUNT_MERGED | COBJ_REFCOUNT_QUEUED)) && REFCOUNT_COUNT(new) < 0){
+			new |= COBJ_REFCOUNT_QUEUED;
+		}
+	} while(!atomic_compare_exchange_weak_explicit(&refcount->shared, &old, new, memory_order_acq_rel, memory_order_relaxed));
+	
+	if((new & COBJ_REFCOUNT_QUEUED) && !(old & COBJ_REFCOUNT_QUEUED)){
+		refcount_enqueue(refcount);
+	} else if(new == COBJ_REFCOUNT_MERGED){
+		// merged, not queued and no references left
+		refcount_finalize(refcount);
+	}
+}
+
+// adds the biased count to the shared count, and clears the COBJ_REFCOUNT_QUEUED flag if dequeued.
+//	Returns true if there are no references left
+static bool refcount_merge(cobj_refcount * refcount, intptr_t clear)
+{
+	intptr_t biased = refcount->merged ? 0 : (intptr_t)refcount->biased * COBJ_REFCOUNT_ONE;
+	intptr_t old = atomic_load_explicit(&refcount->shared, memory_order_relaxed);
+	intptr_t new;
+	
+	do {
+		new = ((old & ~clear) + biased) | COBJ_REFCOUNT_MERGED;
+	} while(!atomic_compare_exchange_weak_explicit(&refcount->shared, &old, new, memory_order_acq_rel, memory_order_relaxed));
+	
+	refcount->biased = 0;
+	refcount->merged = true;
+	
+	// if still queued, the flush will finalize it
+	return new == COBJ_REFCOUNT_MERGED;
+}
+
+void cobj_refcount_merge(cobj_refcount * refcount)
+{
+	if(refcount_merge(refcount, 0)){
+		refcount_finalize(refcount);
+	}
+}
+
+void cobj_refcount_flush(void)
+{
+	if(!cobj_refcount_current){
+		return;
+	}
+	
+	cobj_refcount * refcount = atomic_exchange_explicit(&cobj_refcount_current->head, NULL, memory_order_acquire);
+	
+	while(refcount){
+		// read before the object may be finalized
+		cobj_refcount * next = refcount->next;
+		
+		if(refcount_merge(refcount, COBJ_REFCOUNT_QUEUED)){
+			refcount_finalize(refcount);
+		}
+		
+		refcount = next;
+	}
+}
@@ -0,0 +1,145 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef COBJ_REFCOUNT_H_
+#define COBJ_REFCOUNT_H_
+
+//////////////////////////////////////////////////////////////////////////
+// biased reference counting for classes defining COBJ_CLASS_REFCOUNTED
+//
+//	Most objects are only used by the thread which created them (the owner). So the
+//	count is split into two parts:
+//	* biased: changed by the owner only, without atomic operations
+//	* shared: changed by all other threads, with atomic operations
+//
+//	A thread may release a reference it got from the owner, so the shared count
+//	gets negative. Then the object is queued to the owner, which merges both counts
+//	when it calls cobj_refcount_flush. Decrements of other threads are batched this way,
+//	the owner doesn't need to check the shared count on each release.
+//
+//	When the biased count of the owner drops to 0, the counts are merged too, and
+//	the object is released by the shared count only. When the merged count drops
+//	to 0, the finalize method of the class is called (finalize_impl).
+//
+//	Objects defined by COBJ_STATIC_OBJECT have no owner, they are never finalized.
+//	The owner needs to call cobj_refcount_flush periodically (e.g. in it's main loop).
+//
+//	The owner is identified by it's queue, which is taken from a pool (COBJ_REFCOUNT_THREADS)
+//	when the thread initializes it's first object. When the thread exits, it flushes the queue,
+//	and returns it to the pool: the next thread taking the queue owns the objects of the exited
+//	thread. So a queue is never used by two threads, and never freed while objects refer to it.
+//	If the pool is empty, the objects are initialized merged (shared count only).
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "cobj.h"
+
+// the number of queues, and so of threads owning objects at the same time
+#ifndef COBJ_REFCOUNT_THREADS
+#	define COBJ_REFCOUNT_THREADS	64
+#endif
+
+typedef struct cobj_refcount_queue {
+	struct cobj_refcount * _Atomic head;
+	
+	// set while a thread uses the queue
+	atomic_bool used;
+} cobj_refcount_queue;
+
+typedef struct cobj_refcount {
+	// the queue of the owning thread, or null if the object is static
+	cobj_refcount_queue * owner;
+	
+	// accessed by the owner only
+	unsigned int biased;
+	bool merged;
+	
+	// count * COBJ_REFCOUNT_ONE, and the COBJ_REFCOUNT_MERGED and COBJ_REFCOUNT_QUEUED flags
+	atomic_intptr_t shared;
+	
+	// link in the queue of the owner
+	struct cobj_refcount * next;
+} cobj_refcount;
+
+#define COBJ_REFCOUNT_MERGED	1
+#define COBJ_REFCOUNT_QUEUED	2
+#define COBJ_REFCOUNT_ONE		4
+
+// the queue of the current thread, or null if it didn't initialize an object yet. It's address identifies the thread as owner.
+extern _Thread_local cobj_refcount_queue * cobj_refcount_current;
+
+// the refcount is always the first member after the class_descriptor
+static inline cobj_refcount * cobj_refcount_of(cobj_object * object)
+{
+	return (cobj_refcount *)object->object_data;
+}
+
+// called by the generated initializer, the current thread becomes the owner holding 1 reference
+void cobj_refcount_initialize(cobj_refcount * refcount);
+
+// slow path for threads not owning the object, or after the counts have been merged
+void cobj_refcount_retain_shared(cobj_refcount * refcount);
+void cobj_refcount_release_shared(cobj_refcount * refcount);
+
+// called by the owner, if the biased count drops to 0
+void cobj_refcount_merge(cobj_refcount * refcount);
+
+// merges the counts of the objects queued to the current thread.
+void cobj_refcount_flush(void);
+
+// the owner of the refcount is the current thread. Static objects have no owner, and
+//	the current thread has no queue before it initialized an object.
+static inline bool cobj_refcount_is_owner(const cobj_refcount * refcount)
+{
+	return refcount->owner && refcount->owner == cobj_refcount_current;
+}
+
+static inline void cobj_retain(cobj_object * object)
+{
+	cobj_refcount * refcount = cobj_refcount_of(object);
+	
+	if(cobj_refcount_is_owner(refcount) && !refcount->merged){
+		refcount->biased++;
+	} else {
+		cobj_refcount_retain_shared(refcount);
+	}
+}
+
+static inline void cobj_release(cobj_object * object)
+{
+	cobj_refcount * refcount = cobj_refcount_of(object);
+	
+	if(cobj_refcount_is_owner(refcount) && !refcount->merged){
+		if(--refcount->biased == 0){
+			cobj_refcount_merge(refcount);
+		}
+	} else {
+		cobj_refcount_release_shared(refcount);
+	}
+}
+
+#endif /* COBJ_REFCOUNT_H_ */
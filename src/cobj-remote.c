@@ -0,0 +1,331 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "cobj-remote.h"
+
+// the messages are aligned, so the header of the next message always fits
+#define REMOTE_ALIGN	_Alignof(max_align_t)
+
+// the producer checks the time after this number of yields, while the ring is full
+#define REMOTE_YIELDS_PER_CHECK	64
+
+// the futex is not private, because the ring is shared by processes. timeout is relative, or null.
+static void remote_futex_wait(atomic_uint * word, unsigned int value, const struct timespec * timeout)
+{
+	syscall(SYS_futex, word, FUTEX_WAIT, value, timeout, NULL, 0);
+}
+
+static void remote_futex_wake(atomic_uint * word)
+{
+	syscall(SYS_futex, word, FUTEX_WAKE, 1, NULL, NULL, 0);
+}
+
+static void remote_cursor_initialize(cobj_remote_cursor * cursor)
+{
+	atomic_init(&cursor->position, 0);
+	cursor->other_position = 0;
+	cursor->reserved = 0;
+	atomic_init(&cursor->sleeping, 0);
+	atomic_init(&cursor->wakeups, 0);
+}
+
+// the deadline of a wait of timeout_ms, which is negative without timeout
+static struct timespec remote_deadline(int timeout_ms)
+{
+	struct timespec deadline = { 0, 0 };
+	
+	if(timeout_ms >= 0){
+		clock_gettime(CLOCK_MONOTONIC, &deadline);
+		deadline.tv_sec += timeout_ms / 1000;
+		deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+		
+		if(deadline.tv_nsec >= 1000000000){
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000;
+		}
+	}
+	
+	return deadline;
+}
+
+// sets remaining to the time until the deadline. Returns false, if it has passed.
+static bool remote_remaining(const struct timespec * deadline, struct timespec * remaining)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	remaining->tv_sec = deadline->tv_sec - now.tv_sec;
+	remaining->tv_nsec = deadline->tv_nsec - now.tv_nsec;
+	
+	if(remaining->tv_nsec < 0){
+		remaining->tv_sec--;
+		remaining->tv_nsec += 1000000000;
+	}
+	
+	return remaining->tv_sec >= 0 && (remaining->tv_sec > 0 || remaining->tv_nsec > 0);
+}
+
+void cobj_remote_channel_initialize(cobj_remote_channel * channel)
+{
+	remote_cursor_initialize(&channel->requests.producer);
+	remote_cursor_initialize(&channel->requests.consumer);
+	remote_cursor_initialize(&channel->replies.producer);
+	remote_cursor_initialize(&channel->replies.consumer);
+	
+	channel->timeout_ms = COBJ_REMOTE_TIMEOUT_MS;
+	atomic_init(&channel->status, cobj_remote_status_ok);
+}
+
+cobj_remote_status cobj_remote_channel_status(cobj_remote_channel * channel)
+{
+	return (cobj_remote_status)atomic_load_explicit(&channel->status, memory_order_relaxed);
+}
+
+// the first failure is kept
+static void remote_channel_fail(cobj_remote_channel * channel, cobj_remote_status status)
+{
+	int ok = cobj_remote_status_ok;
+	atomic_compare_exchange_strong_explicit(&channel->status, &ok, status, memory_order_relaxed, memory_order_relaxed);
+}
+
+void * cobj_remote_ring_reserve(cobj_remote_ring * ring, uint32_t method, size_t size, int timeout_ms)
+{
+	struct timespec deadline = remote_deadline(timeout_ms);
+	unsigned int yields = 0;
+	
+	size_t position = atomic_load_explicit(&ring->producer.position, memory_order_relaxed);
+	size_t contiguous = COBJ_REMOTE_RING_SIZE - position % COBJ_REMOTE_RING_SIZE;
+	
+	size = (size + REMOTE_ALIGN - 1) / REMOTE_ALIGN * REMOTE_ALIGN;
+	
+	// a message is never split, the rest of the ring is skipped by a padding message
+	size_t needed = contiguous < size ? contiguous + size : size;
+	
+	while(position + needed - ring->producer.other_position > COBJ_REMOTE_RING_SIZE){
+		ring->producer.other_position = atomic_load_explicit(&ring->consumer.position, memory_order_acquire);
+		
+		if(position + needed - ring->producer.other_position > COBJ_REMOTE_RING_SIZE){
+			struct timespec remaining;
+			
+			if(timeout_ms >= 0 && ++yields % REMOTE_YIELDS_PER_CHECK == 0 && !remote_remaining(&deadline, &remaining)){
+				return NULL;
+			}
+			
+			// the consumer is busy, it doesn't need to be woken up
+			sched_yield();
+		}
+	}
+	
+	if(contiguous < size){
+		cobj_remote_header * padding = (cobj_remote_header *)&ring->data[position % COBJ_REMOTE_RING_SIZE];
+		padding->method = COBJ_REMOTE_PADDING;
+		padding->size = (uint32_t)contiguous;
+		position += contiguous;
+	}
+	
+	cobj_remote_header * header = (cobj_remote_header *)&ring->data[position % COBJ_REMOTE_RING_SIZE];
+	header->method = method;
+	header->size = (uint32_t)size;
+	
+	ring->producer.reserved = position + size;
+	
+	return header;
+}
+
+void cobj_remote_ring_commit(cobj_remote_ring * ring)
+{
+	atomic_store_explicit(&ring->producer.position, ring->producer.reserved, memory_order_release);
+	
+	// pairs with the fence in cobj_remote_ring_wait: either the consumer sees the message,
+	// or this side sees it sleeping. Under load it's awake, so there is no system call.
+	atomic_thread_fence(memory_order_seq_cst);
+	
+	if(atomic_load_explicit(&ring->consumer.sleeping, memory_order_relaxed)){
+		atomic_fetch_add_explicit(&ring->consumer.wakeups, 1, memory_order_relaxed);
+		remote_futex_wake(&ring->consumer.wakeups);
+	}
+}
+
+const cobj_remote_header * cobj_remote_ring_peek(cobj_remote_ring * ring)
+{
+	for(;;){
+		size_t position = atomic_load_explicit(&ring->consumer.position, memory_order_relaxed);
+		
+		if(position == ring->consumer.other_position){
+			ring->consumer.other_position = atomic_load_explicit(&ring->producer.position, memory_order_acquire);
+			
+			if(position == ring->consumer.other_position){
+				return NULL;
+			}
+		}
+		
+		const cobj_remote_header * header = (const cobj_remote_header *)&ring->data[position % COBJ_REMOTE_RING_SIZE];
+		
+		if(header->method != COBJ_REMOTE_PADDING){
+			return header;
+		}
+		
+		atomic_store_explicit(&ring->consumer.position, position + header->size, memory_order_release);
+	}
+}
+
+const cobj_remote_header * cobj_remote_ring_wait(cobj_remote_ring * ring, int timeout_ms)
+{
+	struct timespec deadline = remote_deadline(timeout_ms);
+	
+	for(unsigned int spin = 0;; spin++){
+		const cobj_remote_header * header = cobj_remote_ring_peek(ring);
+		
+		if(header){
+			return header;
+		}
+		
+		if(spin < COBJ_REMOTE_SPIN){
+			continue;
+		}
+		
+		unsigned int wakeups = atomic_load_explicit(&ring->consumer.wakeups, memory_order_relaxed);
+		atomic_store_explicit(&ring->consumer.sleeping, 1, memory_order_relaxed);
+		atomic_thread_fence(memory_order_seq_cst);
+		
+		header = cobj_remote_ring_peek(ring);
+		
+		struct timespec remaining;
+		bool expired = false;
+		
+		if(!header){
+			if(timeout_ms >= 0){
+				expired = !remote_remaining(&deadline, &remaining);
+			}
+			
+			// returns immediately, if the producer has woken us up since wakeups was read
+			if(!expired){
+				remote_futex_wait(&ring->consumer.wakeups, wakeups, timeout_ms >= 0 ? &remaining : NULL);
+			}
+			
+			header = cobj_remote_ring_peek(ring);
+		}
+		
+		atomic_store_explicit(&ring->consumer.sleeping, 0, memory_order_relaxed);
+		
+		if(header || expired){
+			return header;
+		}
+	}
+}
+
+void cobj_remote_ring_release(cobj_remote_ring * ring, const cobj_remote_header * message)
+{
+	size_t position = atomic_load_explicit(&ring->consumer.position, memory_order_relaxed);
+	atomic_store_explicit(&ring->consumer.position, position + message->size, memory_order_release);
+}
+
+void * cobj_remote_request(cobj_remote_channel * channel, uint32_t method, size_t size)
+{
+	if(cobj_remote_channel_status(channel) != cobj_remote_status_ok){
+		return NULL;
+	}
+	
+	void * request = cobj_remote_ring_reserve(&channel->requests, method, size, channel->timeout_ms);
+	
+	if(!request){
+		remote_channel_fail(channel, cobj_remote_status_timeout);
+	}
+	
+	return request;
+}
+
+const cobj_remote_header * cobj_remote_call(cobj_remote_channel * channel, uint32_t method)
+{
+	cobj_remote_ring_commit(&channel->requests);
+	
+	const cobj_remote_header * reply = cobj_remote_ring_wait(&channel->replies, channel->timeout_ms);
+	
+	if(!reply){
+		// a late reply would be taken for the reply of the next call, so the channel can't be used anymore
+		remote_channel_fail(channel, cobj_remote_status_timeout);
+		return NULL;
+	}
+	
+	// a request before (without result) may have failed too
+	if(reply->method != method){
+		cobj_remote_ring_release(&channel->replies, reply);
+		remote_channel_fail(channel, cobj_remote_status_unknown_method);
+		return NULL;
+	}
+	
+	return reply;
+}
+
+void cobj_remote_close(cobj_remote_channel * channel)
+{
+	if(cobj_remote_ring_reserve(&channel->requests, COBJ_REMOTE_CLOSE, sizeof(cobj_remote_header), channel->timeout_ms)){
+		cobj_remote_ring_commit(&channel->requests);
+	}
+}
+
+void * cobj_remote_reply(cobj_remote_channel * channel, uint32_t method, size_t size)
+{
+	return cobj_remote_ring_reserve(&channel->replies, method, size, channel->timeout_ms);
+}
+
+// answers a request the stub doesn't know, the client waits for it if the method has a result
+static void remote_reply_error(cobj_remote_channel * channel)
+{
+	if(cobj_remote_reply(channel, COBJ_REMOTE_ERROR, sizeof(cobj_remote_header))){
+		cobj_remote_ring_commit(&channel->replies);
+	}
+}
+
+void cobj_remote_serve(cobj_remote_channel * channel, cobj_remote_dispatch dispatch, const void * target)
+{
+	for(;;){
+		const cobj_remote_header * request = cobj_remote_ring_wait(&channel->requests, -1);
+		
+		// all requests available are executed as a batch, without sleeping between them
+		do {
+			if(request->method == COBJ_REMOTE_CLOSE){
+				cobj_remote_ring_release(&channel->requests, request);
+				return;
+			}
+			
+			// the arguments are read in place, so the request is released afterwards
+			if(!dispatch(target, request, channel)){
+				remote_reply_error(channel);
+			}
+			
+			cobj_remote_ring_release(&channel->requests, request);
+			
+			request = cobj_remote_ring_peek(&channel->requests);
+		} while(request);
+	}
+}
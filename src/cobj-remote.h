@@ -0,0 +1,197 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef COBJ_REMOTE_H_
+#define COBJ_REMOTE_H_
+
+//////////////////////////////////////////////////////////////////////////
+// calls to objects in another process, over rings in shared memory
+//
+//	A channel is placed in memory shared by two processes (like mmap with MAP_SHARED),
+//	and initialized by one of them before the other uses it:
+//
+//	cobj_remote_channel * channel = mmap(NULL, sizeof(cobj_remote_channel), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+//	cobj_remote_channel_initialize(channel);
+//
+//	The interfaces are generated in COBJ_INTERFACE_REMOTE_MODE once (like in the interface-registry),
+//	which generates a proxy class and a stub for them. The client calls a proxy like any other object,
+//	each call is written as message into the request ring:
+//
+//	gpio_pin_proxy proxy;
+//	gpio_pin_proxy_initialize(&proxy, channel);
+//	gpio_pin pin;
+//	gpio_pin_queryinterface(&proxy.object, &pin);
+//	gpio_pin_set_value(&pin, true);
+//
+//	The server dispatches the messages to a real object, until the client closes the channel:
+//
+//	gpio_pin_stub_serve(channel, &pin_of_real_object);
+//
+//	Methods returning void don't wait for the server, so they are pipelined. Methods with a result
+//	wait for the reply, which also means that all calls before have been executed. The server
+//	executes all messages available before it sleeps, and the client only wakes up the server if it
+//	sleeps, so calls under load are batched without any system call.
+//
+//	The arguments are copied as they are. Pointers are only valid for the server if they point into
+//	shared memory at the same address. Each ring has a single producer and a single consumer, so a
+//	channel is used by one thread of the client and one thread of the server. Linux only (futex).
+//
+//	The client waits at most timeout_ms of the channel for the server (for a reply, or for space in
+//	the request ring), so a dead or stuck server doesn't block it forever. Then, or if the server
+//	didn't know a method, the channel fails: cobj_remote_channel_status returns the reason, and the
+//	proxy returns a zero result for this and all later calls without waiting. The server waits for
+//	requests without timeout, a supervisor stops it with cobj_remote_close if the client died.
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cobjpvt-pp.h"
+
+// the size of each ring, in bytes. A message must not be larger than half of it.
+#ifndef COBJ_REMOTE_RING_SIZE
+#	define COBJ_REMOTE_RING_SIZE	(64 * 1024)
+#endif
+
+// the default of cobj_remote_channel.timeout_ms
+#ifndef COBJ_REMOTE_TIMEOUT_MS
+#	define COBJ_REMOTE_TIMEOUT_MS	5000
+#endif
+
+// the client spins this number of times for a reply (or the server for a request), before it sleeps
+#ifndef COBJ_REMOTE_SPIN
+#	define COBJ_REMOTE_SPIN	1000
+#endif
+
+#define COBJ_REMOTE_CACHE_LINE	64
+
+COBJPVT_ASSERT((COBJ_REMOTE_RING_SIZE & (COBJ_REMOTE_RING_SIZE - 1)) == 0, "COBJ_REMOTE_RING_SIZE must be a power of 2");
+
+// the method of a message is the index of the method in the mt, or one of these
+#define COBJ_REMOTE_PADDING	0xFFFFFFFFu
+#define COBJ_REMOTE_CLOSE	0xFFFFFFFEu
+
+// the reply of a request the stub didn't know
+#define COBJ_REMOTE_ERROR	0xFFFFFFFDu
+
+typedef enum cobj_remote_status {
+	cobj_remote_status_ok,
+	
+	// the server didn't reply, or didn't read the requests within timeout_ms
+	cobj_remote_status_timeout,
+	
+	// the server didn't know a method, it has been compiled with another interface
+	cobj_remote_status_unknown_method
+} cobj_remote_status;
+
+// the first member of each message. The size includes the header, and is aligned to max_align_t.
+typedef struct cobj_remote_header {
+	uint32_t method;
+	uint32_t size;
+} cobj_remote_header;
+
+// the producer and the consumer use their own cache-line
+typedef struct cobj_remote_cursor {
+	// number of bytes committed by this side, written by this side only
+	_Alignas(COBJ_REMOTE_CACHE_LINE) atomic_size_t position;
+	
+	// the last position of the other side seen, to avoid reading the other cache-line
+	size_t other_position;
+	
+	// the position after the message reserved (producer only)
+	size_t reserved;
+	
+	// the consumer sleeps on wakeups (futex), while sleeping is set (consumer only)
+	atomic_uint sleeping;
+	atomic_uint wakeups;
+} cobj_remote_cursor;
+
+typedef struct cobj_remote_ring {
+	cobj_remote_cursor producer;
+	cobj_remote_cursor consumer;
+	_Alignas(COBJ_REMOTE_CACHE_LINE) unsigned char data[COBJ_REMOTE_RING_SIZE];
+} cobj_remote_ring;
+
+typedef struct cobj_remote_channel {
+	// written by the client (the proxy)
+	cobj_remote_ring requests;
+	
+	// written by the server (the stub)
+	cobj_remote_ring replies;
+	
+	// the maximum time to wait for the other side, or -1 to wait forever. COBJ_REMOTE_TIMEOUT_MS by default.
+	int timeout_ms;
+	
+	// a cobj_remote_status, set by the client when a call failed. The channel can't be used anymore then.
+	atomic_int status;
+} cobj_remote_channel;
+
+// the stub of an interface, target points to the reference of the interface. Returns false for an unknown method.
+typedef bool (* cobj_remote_dispatch)(const void * target, const cobj_remote_header * request, cobj_remote_channel * channel);
+
+// initializes the channel in shared memory, before any process uses it
+void cobj_remote_channel_initialize(cobj_remote_channel * channel);
+
+// returns the status of the client, a channel failed stays failed
+cobj_remote_status cobj_remote_channel_status(cobj_remote_channel * channel);
+
+// reserves a message of size bytes (including the header), waits while the ring is full.
+//	Returns null if the ring is still full after timeout_ms (-1: no timeout).
+void * cobj_remote_ring_reserve(cobj_remote_ring * ring, uint32_t method, size_t size, int timeout_ms);
+
+// makes the message reserved visible to the consumer, wakes it up if it sleeps
+void cobj_remote_ring_commit(cobj_remote_ring * ring);
+
+// returns the next message, or null if there is none
+const cobj_remote_header * cobj_remote_ring_peek(cobj_remote_ring * ring);
+
+// returns the next message, sleeps until there is one. Returns null, if there is none after timeout_ms (-1: no timeout).
+const cobj_remote_header * cobj_remote_ring_wait(cobj_remote_ring * ring, int timeout_ms);
+
+// frees the message returned by peek or wait
+void cobj_remote_ring_release(cobj_remote_ring * ring, const cobj_remote_header * message);
+
+// reserves a request of the client. Returns null, if the channel failed.
+void * cobj_remote_request(cobj_remote_channel * channel, uint32_t method, size_t size);
+
+// commits the request reserved, and waits for the reply of the method. Release the reply after reading the result.
+//	Returns null, if the channel failed.
+const cobj_remote_header * cobj_remote_call(cobj_remote_channel * channel, uint32_t method);
+
+// reserves a reply of the server. Returns null if the client doesn't read the replies within timeout_ms,
+//	the reply is dropped then.
+void * cobj_remote_reply(cobj_remote_channel * channel, uint32_t method, size_t size);
+
+// lets cobj_remote_serve return, after all requests before
+void cobj_remote_close(cobj_remote_channel * channel);
+
+// dispatches the requests to the stub, until the channel is closed. Requests the stub doesn't
+//	know are answered with COBJ_REMOTE_ERROR.
+void cobj_remote_serve(cobj_remote_channel * channel, cobj_remote_dispatch dispatch, const void * target);
+
+
+#endif /* COBJ_REMOTE_H_ */
@@ -0,0 +1,124 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include <string.h>
+
+#include "cobj-shared.h"
+
+// a published object has an odd class_descriptor, which is never the address of a descriptor
+#define SHARED_TAG	((uintptr_t)1)
+
+typedef struct shared_entry {
+	uint32_t id;
+	const cobj_class_descriptor * descriptor;
+} shared_entry;
+
+// open addressing, the ids are hashes already
+static shared_entry classes[COBJ_SHARED_CLASSES];
+
+uint32_t cobj_shared_class_id(const char * class_name)
+{
+	// FNV-1a, reduced to 31 bits, so it fits next to the tag
+	uint32_t hash = 2166136261u;
+	
+	while(*class_name){
+		hash ^= (unsigned char)*class_name++;
+		hash *= 16777619u;
+	}
+	
+	// 0 marks a free entry
+	hash &= 0x7FFFFFFFu;
+	return hash ? hash : 1;
+}
+
+static shared_entry * shared_find(uint32_t id)
+{
+	for(size_t i = 0; i < COBJ_SHARED_CLASSES; i++){
+		shared_entry * entry = &classes[(id + i) & (COBJ_SHARED_CLASSES - 1)];
+		
+		if(entry->id == id || entry->id == 0){
+			return entry;
+		}
+	}
+	
+	return NULL;
+}
+
+bool cobj_shared_register(const cobj_class_descriptor * descriptor)
+{
+	uint32_t id = cobj_shared_class_id(descriptor->class_name);
+	shared_entry * entry = shared_find(id);
+	
+	if(!entry){
+		return false;
+	}
+	
+	if(entry->id){
+		// registered twice is fine, but the ids of two classes must not collide
+		return strcmp(entry->descriptor->class_name, descriptor->class_name) == 0;
+	}
+	
+	entry->id = id;
+	entry->descriptor = descriptor;
+	return true;
+}
+
+bool cobj_shared_publish(cobj_object * object)
+{
+	uintptr_t value = (uintptr_t)object->class_descriptor;
+	
+	if(value & SHARED_TAG){
+		return true;
+	}
+	
+	uint32_t id = cobj_shared_class_id(object->class_descriptor->class_name);
+	shared_entry * entry = shared_find(id);
+	
+	if(!entry || entry->id != id){
+		return false;
+	}
+	
+	object->class_descriptor = (const cobj_class_descriptor *)(((uintptr_t)id << 1) | SHARED_TAG);
+	return true;
+}
+
+const cobj_class_descriptor * cobj_shared_class(const cobj_object * object)
+{
+	uintptr_t value = (uintptr_t)object->class_descriptor;
+	
+	if(!(value & SHARED_TAG)){
+		return object->class_descriptor;
+	}
+	
+	shared_entry * entry = shared_find((uint32_t)(value >> 1));
+	return entry && entry->id ? entry->descriptor : NULL;
+}
+
+cobj_mt cobj_shared_queryinterface(const cobj_object * object, const cobj_interface_descriptor * interface)
+{
+	const cobj_class_descriptor * descriptor = cobj_shared_class(object);
+	return descriptor ? descriptor->queryinterface(interface) : (cobj_mt)0;
+}
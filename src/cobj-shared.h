@@ -0,0 +1,101 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef COBJ_SHARED_H_
+#define COBJ_SHARED_H_
+
+//////////////////////////////////////////////////////////////////////////
+// objects in memory shared by processes, which may be mapped at different addresses
+//
+//	The class_descriptor of an object and the mt of a reference are addresses in the process
+//	which created them. So an object in shared memory is published: it's class_descriptor is
+//	replaced by the id of the class, which each process resolves by it's own table. The classes
+//	are registered by each process at startup, the id is derived from the class name:
+//
+//	cobj_shared_register(&hw_gpio_pin_descriptor_instance);
+//
+//	hw_gpio_pin * pin = shared_segment_alloc(sizeof(hw_gpio_pin));
+//	hw_gpio_pin_initialize(pin, 13);
+//	cobj_shared_publish(&pin->object);
+//
+//	References between objects in shared memory are stored as INTERFACE_shared, which holds the
+//	offset of the object relative to itself, so they are valid at any address of the segment. A
+//	process resolves it to an ordinary reference, using the mt of the class in this process:
+//
+//	gpio_pin_shared_set(&graph->input, &pin->object);
+//	...
+//	gpio_pin input;
+//	if(gpio_pin_resolve(&graph->input, &input)){
+//		gpio_pin_get_value(&input);
+//	}
+//
+//	Published objects can't be used with INTERFACE_queryinterface anymore, use INTERFACE_resolve
+//	or cobj_shared_queryinterface. Pointers in the variables of the objects are not converted, so
+//	use INTERFACE_shared for the references to other objects.
+
+#include <stdint.h>
+
+#include "cobj.h"
+
+// the number of classes each process can register, a power of 2
+#ifndef COBJ_SHARED_CLASSES
+#	define COBJ_SHARED_CLASSES	64
+#endif
+
+COBJPVT_ASSERT((COBJ_SHARED_CLASSES & (COBJ_SHARED_CLASSES - 1)) == 0, "COBJ_SHARED_CLASSES must be a power of 2");
+
+// the offset of an object, relative to the address of the offset. 0 is null.
+typedef ptrdiff_t cobj_shared_offset;
+
+// the id of a class, the same in all processes
+uint32_t cobj_shared_class_id(const char * class_name);
+
+// registers the class in this process. Fails if the table is full, or a different class has the same id.
+// Classes are registered before the shared objects are used, it's not thread-safe.
+bool cobj_shared_register(const cobj_class_descriptor * descriptor);
+
+// replaces the class_descriptor of the object by the id of it's class. The class must be registered.
+bool cobj_shared_publish(cobj_object * object);
+
+// returns the descriptor of the class in this process, for published and for ordinary objects.
+// Returns null, if the class is not registered in this process.
+const cobj_class_descriptor * cobj_shared_class(const cobj_object * object);
+
+// queryinterface, for published and for ordinary objects
+cobj_mt cobj_shared_queryinterface(const cobj_object * object, const cobj_interface_descriptor * interface);
+
+static inline void cobj_shared_offset_set(cobj_shared_offset * offset, const void * object)
+{
+	*offset = object ? (const char *)object - (const char *)offset : 0;
+}
+
+static inline cobj_object * cobj_shared_offset_get(const cobj_shared_offset * offset)
+{
+	return *offset ? (cobj_object *)((const char *)offset + *offset) : (cobj_object *)0;
+}
+
+
+#endif /* COBJ_SHARED_H_ */
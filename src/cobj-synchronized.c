@@ -0,0 +1,125 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "cobj-synchronized.h"
+
+#define SYNCHRONIZED_CACHE_LINE	64
+
+// the stripes are on their own cache lines, so they don't share them
+typedef struct {
+	_Alignas(SYNCHRONIZED_CACHE_LINE) cobj_rwlock lock;
+} synchronized_stripe;
+
+static synchronized_stripe stripes[COBJ_RWLOCK_STRIPES];
+
+// returns immediately, if the state isn't value anymore
+static void synchronized_futex_wait(atomic_uint * word, unsigned int value)
+{
+	syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+static void synchronized_futex_wake_all(atomic_uint * word)
+{
+	syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, INT32_MAX, NULL, NULL, 0);
+}
+
+void cobj_rwlock_initialize(cobj_rwlock * lock)
+{
+	atomic_init(&lock->state, 0);
+}
+
+// sets the waiting flag, and sleeps until the state changes. Returns without sleeping, if the state was changed meanwhile.
+static void rwlock_sleep(cobj_rwlock * lock, unsigned int state)
+{
+	if(!(state & COBJ_RWLOCK_WAITING)){
+		if(!atomic_compare_exchange_strong_explicit(&lock->state, &state, state | COBJ_RWLOCK_WAITING, memory_order_relaxed, memory_order_relaxed)){
+			return;
+		}
+	}
+	
+	synchronized_futex_wait(&lock->state, state | COBJ_RWLOCK_WAITING);
+}
+
+void cobj_rwlock_read_lock(cobj_rwlock * lock)
+{
+	for(unsigned int spin = 0;; spin++){
+		unsigned int state = atomic_load_explicit(&lock->state, memory_order_relaxed);
+		
+		// waiting writers block new readers
+		if(!(state & (COBJ_RWLOCK_WRITER | COBJ_RWLOCK_WAITING))){
+			if(atomic_compare_exchange_weak_explicit(&lock->state, &state, state + 1, memory_order_acquire, memory_order_relaxed)){
+				return;
+			}
+		} else if(spin >= COBJ_RWLOCK_SPIN){
+			rwlock_sleep(lock, state);
+		}
+	}
+}
+
+void cobj_rwlock_read_unlock(cobj_rwlock * lock)
+{
+	unsigned int state = atomic_fetch_sub_explicit(&lock->state, 1, memory_order_release) - 1;
+	
+	// the last reader wakes the waiting threads. If it fails, a writer took the lock, and wakes them when it's released.
+	if(state == COBJ_RWLOCK_WAITING && atomic_compare_exchange_strong_explicit(&lock->state, &state, 0, memory_order_relaxed, memory_order_relaxed)){
+		synchronized_futex_wake_all(&lock->state);
+	}
+}
+
+void cobj_rwlock_write_lock(cobj_rwlock * lock)
+{
+	for(unsigned int spin = 0;; spin++){
+		unsigned int state = atomic_load_explicit(&lock->state, memory_order_relaxed);
+		
+		if(!(state & (COBJ_RWLOCK_WRITER | COBJ_RWLOCK_READERS))){
+			if(atomic_compare_exchange_weak_explicit(&lock->state, &state, state | COBJ_RWLOCK_WRITER, memory_order_acquire, memory_order_relaxed)){
+				return;
+			}
+		} else if(spin >= COBJ_RWLOCK_SPIN){
+			rwlock_sleep(lock, state);
+		}
+	}
+}
+
+void cobj_rwlock_write_unlock(cobj_rwlock * lock)
+{
+	unsigned int state = atomic_fetch_and_explicit(&lock->state, ~(COBJ_RWLOCK_WRITER | COBJ_RWLOCK_WAITING), memory_order_release);
+	
+	if(state & COBJ_RWLOCK_WAITING){
+		synchronized_futex_wake_all(&lock->state);
+	}
+}
+
+// the low bits of the address are the same for aligned objects, so they are mixed (fibonacci hashing)
+cobj_rwlock * cobj_rwlock_stripe(const void * object)
+{
+	uint64_t hash = (uint64_t)(uintptr_t)object * UINT64_C(11400714819323198485);
+	
+	return &stripes[(hash >> 32) % COBJ_RWLOCK_STRIPES].lock;
+}
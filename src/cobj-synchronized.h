@@ -0,0 +1,94 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+#ifndef COBJ_SYNCHRONIZED_H_
+#define COBJ_SYNCHRONIZED_H_
+
+//////////////////////////////////////////////////////////////////////////
+// synchronized access to objects shared by threads
+//
+//	The interfaces are generated in COBJ_INTERFACE_SYNCHRONIZED_MODE once (like in the interface-registry),
+//	which generates a synchronized class for them. It decorates a reference, and calls it while
+//	holding a reader/writer lock: pure methods (see COBJ_INTERFACE_PURE_METHOD) share the lock, all
+//	other methods hold it exclusively.
+//
+//	static cobj_rwlock lock = COBJ_RWLOCK_INITIALIZER;
+//	COBJ_SYNCHRONIZED(gpio_pin) synchronized_pin;
+//	gpio_pin_synchronized_initialize(&synchronized_pin, &production_pin, &lock);
+//	gpio_pin_queryinterface(&synchronized_pin.object, &application_resources.output_pin);
+//
+//	Instead of a lock per object, the locks can be striped: cobj_rwlock_stripe returns one of
+//	COBJ_RWLOCK_STRIPES locks, selected by the address of the object. All decorators of an
+//	object share the same stripe, so they exclude each other.
+//
+//	gpio_pin_synchronized_initialize(&synchronized_pin, &production_pin, cobj_rwlock_stripe(production_pin.object));
+//
+//	The lock spins COBJ_RWLOCK_SPIN times, before it sleeps (futex). Waiting writers block new readers,
+//	so writers are not starved. The lock is not recursive, so a method must not call another
+//	method of the same object through the decorator. Linux only (futex).
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cobjpvt-pp.h"
+
+// the type of the synchronized decorator of an interface
+#define COBJ_SYNCHRONIZED(GEN_INTERFACE_NAME)	\
+	COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _synchronized)
+
+// the lock spins this number of times, before it sleeps
+#ifndef COBJ_RWLOCK_SPIN
+#	define COBJ_RWLOCK_SPIN	100
+#endif
+
+// the number of locks of cobj_rwlock_stripe
+#ifndef COBJ_RWLOCK_STRIPES
+#	define COBJ_RWLOCK_STRIPES	64
+#endif
+
+// the state: the number of readers, and the flags
+#define COBJ_RWLOCK_WRITER	0x80000000u
+#define COBJ_RWLOCK_WAITING	0x40000000u
+#define COBJ_RWLOCK_READERS	0x3FFFFFFFu
+
+typedef struct cobj_rwlock {
+	atomic_uint state;
+} cobj_rwlock;
+
+#define COBJ_RWLOCK_INITIALIZER	{ 0 }
+
+void cobj_rwlock_initialize(cobj_rwlock * lock);
+
+void cobj_rwlock_read_lock(cobj_rwlock * lock);
+void cobj_rwlock_read_unlock(cobj_rwlock * lock);
+void cobj_rwlock_write_lock(cobj_rwlock * lock);
+void cobj_rwlock_write_unlock(cobj_rwlock * lock);
+
+// the stripe of the object
+cobj_rwlock * cobj_rwlock_stripe(const void * object);
+
+
+#endif /* COBJ_SYNCHRONIZED_H_ */
@@ -0,0 +1,97 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+#ifndef COBJ_USDT_H_
+#define COBJ_USDT_H_
+
+//////////////////////////////////////////////////////////////////////////
+// static tracepoints (USDT) in the thunks of the classes
+//
+//	If the classes are compiled with COBJ_USDT defined, each thunk has a probe at the entry
+//	and at the return of the method. They are described in the ELF notes (.note.stapsdt),
+//	like the probes of sys/sdt.h, so perf, bpftrace and systemtap find them without a library.
+//	A probe is a nop, and the arguments are only loaded into registers, until a tracer is attached.
+//
+//	provider cobj, probes entry and return, the arguments are:
+//		arg0	const char * class name
+//		arg1	const char * interface name
+//		arg2	const char * method name
+//		arg3	cobj_object * object
+//
+//	bpftrace -e 'usdt:./demo:cobj:entry { @start[tid] = nsecs; }
+//		usdt:./demo:cobj:return /@start[tid]/ { @ns[str(arg1), str(arg2)] = hist(nsecs - @start[tid]); delete(@start[tid]); }'
+
+#include "cobjpvt-pp.h"
+
+#if defined(__ELF__) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__) || defined(__arm__))
+
+#	if __SIZEOF_POINTER__ == 8
+#		define COBJPVT_USDT_ADDRESS		".8byte"
+#	else
+#		define COBJPVT_USDT_ADDRESS		".4byte"
+#	endif
+
+// the arguments are pointers, described as "size@operand"
+#	define COBJPVT_USDT_ARGUMENT(GEN_OPERAND)	\
+		COBJPVT_PP_STRINGIFY(__SIZEOF_POINTER__) "@%[" #GEN_OPERAND "]"
+
+// the note has the address of the probe, of the base (to detect prelinking), and no semaphore.
+//	_.stapsdt.base is shared with the probes of sys/sdt.h, if they are used in the same binary.
+#	define COBJ_USDT_PROBE4(GEN_PROVIDER, GEN_PROBE, GEN_ARG0, GEN_ARG1, GEN_ARG2, GEN_ARG3)	\
+		__asm__ __volatile__(	\
+			"990:	nop\n"	\
+			".pushsection .note.stapsdt,\"?\",\"note\"\n"	\
+			".balign 4\n"	\
+			".4byte 992f-991f, 994f-993f, 3\n"	\
+			"991:	.asciz \"stapsdt\"\n"	\
+			"992:	.balign 4\n"	\
+			"993:	" COBJPVT_USDT_ADDRESS " 990b\n"	\
+			COBJPVT_USDT_ADDRESS " _.stapsdt.base\n"	\
+			COBJPVT_USDT_ADDRESS " 0\n"	\
+			".asciz \"" #GEN_PROVIDER "\"\n"	\
+			".asciz \"" #GEN_PROBE "\"\n"	\
+			".asciz \"" COBJPVT_USDT_ARGUMENT(arg0) " " COBJPVT_USDT_ARGUMENT(arg1) " " COBJPVT_USDT_ARGUMENT(arg2) " " COBJPVT_USDT_ARGUMENT(arg3) "\"\n"	\
+			"994:	.balign 4\n"	\
+			".popsection\n"	\
+			".ifndef _.stapsdt.base\n"	\
+			".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"	\
+			".weak _.stapsdt.base\n"	\
+			".hidden _.stapsdt.base\n"	\
+			"_.stapsdt.base: .space 1\n"	\
+			".size _.stapsdt.base, 1\n"	\
+			".popsection\n"	\
+			".endif\n"	\
+			:	\
+			: [arg0] "nor" (GEN_ARG0), [arg1] "nor" (GEN_ARG1), [arg2] "nor" (GEN_ARG2), [arg3] "nor" (GEN_ARG3))
+
+#else
+
+// other platforms have no probes
+#	define COBJ_USDT_PROBE4(GEN_PROVIDER, GEN_PROBE, GEN_ARG0, GEN_ARG1, GEN_ARG2, GEN_ARG3)	\
+		do { (void)(GEN_ARG0); (void)(GEN_ARG1); (void)(GEN_ARG2); (void)(GEN_ARG3); } while(0)
+
+#endif
+
+#endif /* COBJ_USDT_H_ */
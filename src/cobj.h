@@ -32,29 +32,88 @@ SOFTWARE.
 #include <stddef.h>
 #include <stdbool.h>
 
+#include "cobjpvt-pp.h"
+
 //////////////////////////////////////////////////////////////////////////
 // base declarations
 typedef void * cobj_mt;
+typedef struct cobj_object cobj_object;
 
 //////////////////////////////////////////////////////////////////////////
 // core descriptor types
 
 typedef const char * cobj_descriptor_string;
 
-typedef struct {
+// the kind of a method, see COBJ_INTERFACE_PURE_METHOD, COBJ_INTERFACE_MUTATING_METHOD and COBJ_INTERFACE_SETTER_METHOD
+typedef enum cobj_method_kind {
+	cobj_method_kind_regular,
+	cobj_method_kind_pure,
+	cobj_method_kind_mutating,
+	cobj_method_kind_setter
+} cobj_method_kind;
+
+// an argument of a method, the offset is the offset in the packed arguments (see cobj_invoke).
+//	The type is the name after preprocessing (bool is _Bool).
+typedef struct cobj_argument_descriptor {
+	cobj_descriptor_string type_name;
+	cobj_descriptor_string argument_name;
+	size_t size;
+	size_t offset;
+} cobj_argument_descriptor;
+
+typedef struct cobj_method_descriptor {
+	cobj_descriptor_string method_name;
+	cobj_method_kind kind;
+	
+	// the index of the method in the mt, the methods of the base come first
+	size_t index;
+	
+	// the size of the result is 0 for void methods
+	cobj_descriptor_string return_type_name;
+	size_t return_size;
+	
+	// the packed arguments are a struct, with the arguments as members (INTERFACE_METHOD_arguments)
+	size_t arguments_count;
+	const cobj_argument_descriptor * arguments;
+	size_t arguments_size;
+	
+	// calls the method with the packed arguments, see cobj_invoke
+	void (*invoke)(const void * reference, const void * arguments, void * result);
+} cobj_method_descriptor;
+
+typedef struct cobj_interface_descriptor {
 	cobj_descriptor_string interface_name;
 	size_t methods_count;
+	
+	// the interface specified by COBJ_INTERFACE_EXTENDS, or null
+	//	(the address of the descriptor pointer, because this is a constant)
+	const struct cobj_interface_descriptor * const * base_interface;
+	
+	// the methods of this interface (without the methods of the base), terminated by a method_name of null
+	const cobj_method_descriptor * methods;
 } cobj_interface_descriptor;
 
-typedef struct {
+typedef struct cobj_class_descriptor {
 	cobj_descriptor_string class_name;
 	cobj_mt (*queryinterface)(const cobj_interface_descriptor * interface);
+	
+	// called when the last reference is released, if the class defines COBJ_CLASS_REFCOUNTED (see cobj-refcount.h)
+	void (*finalize)(cobj_object * object);
+	
+	// the memory needed for an object, and for it's cold variables (or 0), so objects of classes
+	// unknown at compile time (like in plugins, see cobj-plugin.h) can be created
+	size_t object_size;
+	size_t object_alignment;
+	size_t cold_size;
+	
+	// calls CLASS_initialize, the parameters are passed as CLASS_parameters struct
+	bool (*initialize)(cobj_object * object, void * cold, const void * parameters);
 } cobj_class_descriptor;
 
 //////////////////////////////////////////////////////////////////////////
 // core object and reference types
 
-typedef struct {
+struct cobj_object {
 	
 	// the first member of an object is always a pointer to it's class_descriptor
 	const cobj_class_descriptor * class_descriptor;
@@ -73,13 +132,110 @@ typedef struct {
 	//		return theinterface_foo_impl((theclass*)object)
 	char object_data[];
 	
-} cobj_object;
+};
 
 typedef struct {
 	cobj_mt mt;
 	cobj_object * object;
 } cobj_reference;
 
+//////////////////////////////////////////////////////////////////////////
+// interface inheritance
+//	returns true, if the method-table of the implemented interface can be used for interface.
+//	This is the case for the interface itself, and all of it's bases.
+static inline bool cobj_interface_is_compatible(const cobj_interface_descriptor * implemented, const cobj_interface_descriptor * interface)
+{
+	while(implemented){
+		if(implemented == interface){
+			return true;
+		}
+		
+		implemented = implemented->base_interface ? *implemented->base_interface : (const cobj_interface_descriptor *)0;
+	}
+	
+	return false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// reflection
+//	Generic code (like bindings for scripting, RPC or tracing) looks up a method by name once,
+//	and calls it by it's descriptor, with the arguments packed into the struct INTERFACE_METHOD_arguments
+//	(or at the offsets of the argument descriptors). The result is copied to result, if it's not null.
+//
+//	const cobj_method_descriptor * method = cobj_interface_find_method(gpio_pin_descriptor, "set_value");
+//	gpio_pin_set_value_arguments arguments = { .value = true };
+//	cobj_invoke(method, &output_pin, &arguments, NULL);
+
+// searches the interface, and it's bases (implemented in cobj.c)
+COBJPVT_EXTERN_C_BEGIN
+const cobj_method_descriptor * cobj_interface_find_method(const cobj_interface_descriptor * interface, const char * method_name);
+COBJPVT_EXTERN_C_END
+
+// reference points to the reference of the interface of the method (or of an interface extending it).
+//	It's a single indirect call, the generated invoke of the method calls it through the mt.
+static inline void cobj_invoke(const cobj_method_descriptor * method, const void * reference, const void * arguments, void * result)
+{
+	method->invoke(reference, arguments, result);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// layout of classes
+//	Each class generates the constants NAME_layout_size, NAME_layout_hot_size,
+//	NAME_layout_padding and NAME_layout_cold_size. To detect changes of the layout
+//	(for example in a CI build), they can be pinned:
+//
+//	COBJ_CLASS_ASSERT_LAYOUT(hw_gpio_pin, 12, 0);
+
+#define COBJ_CLASS_ASSERT_LAYOUT(GEN_CLASS_NAME, GEN_SIZE, GEN_PADDING)	\
+	COBJPVT_ASSERT(COBJ_PP_CONCAT(GEN_CLASS_NAME, _layout_size) == (GEN_SIZE), "size of " #GEN_CLASS_NAME " has changed");	\
+	COBJPVT_ASSERT(COBJ_PP_CONCAT(GEN_CLASS_NAME, _layout_padding) == (GEN_PADDING), "padding of " #GEN_CLASS_NAME " has changed")
+
+//////////////////////////////////////////////////////////////////////////
+// static objects and references
+//
+//	If the object graph is known at compile time, objects and references can be
+//	defined with constant initializers, so they need no startup code and may be
+//	placed into program memory if declared const.
+//
+//	COBJ_STATIC_OBJECT(class_name, object_name [, .variable = value, ...])
+//		defines the object, with the class_descriptor and the given variables set.
+//		initialize_impl is not called, so the variables have to be specified the
+//		same way as initialize_impl would set them.
+//
+//	COBJ_STATIC_REFERENCE(interface_name, class_name, object_name)
+//		expands to the initializer of a reference, without calling queryinterface.
+//		The class needs to be specified, because it's not possible to get it
+//		from the object in the preprocessor. If the class doesn't implement the interface,
+//		the method-table is undeclared, so it fails to compile.
+//
+//	static COBJ_STATIC_OBJECT(hw_gpio_pin, input_pin, .port_address = 0xFFFF1000, .port_mask = 1 << 13);
+//	static const gpio_pin input = COBJ_STATIC_REFERENCE(gpio_pin, hw_gpio_pin, input_pin);
+//
+//	COBJ_AS(interface_name, class_name, object_pointer)
+//		calls the accessor class_name_as_interface_name generated by the class header.
+//		A direct call of an accessor the class doesn't have is an implicit declaration in C,
+//		which some compilers only warn about. Here the method-table is undeclared too, so it
+//		always fails to compile.
+//
+//	gpio_pin output = COBJ_AS(gpio_pin, hw_gpio_pin, &output_pin);
+
+#define COBJ_STATIC_OBJECT(GEN_CLASS_NAME, GEN_OBJECT_NAME, ...)	\
+	GEN_CLASS_NAME GEN_OBJECT_NAME = {	\
+		.private_data = {	\
+			.class_desriptor = &COBJ_PP_CONCAT(GEN_CLASS_NAME, _descriptor_instance),	\
+			__VA_ARGS__	\
+		}	\
+	}
+
+#define COBJ_STATIC_REFERENCE(GEN_INTERFACE_NAME, GEN_CLASS_NAME, GEN_OBJECT_NAME)	\
+	{	\
+		.mt = (COBJ_PP_CONCAT(GEN_INTERFACE_NAME, _mt) *)&COBJ_PP_CONCAT(GEN_CLASS_NAME, _, GEN_INTERFACE_NAME, _mt),	\
+		.object = (cobj_object *)&(GEN_OBJECT_NAME).object	\
+	}
+
+#define COBJ_AS(GEN_INTERFACE_NAME, GEN_CLASS_NAME, GEN_OBJECT_POINTER)	\
+	((void)&COBJ_PP_CONCAT(GEN_CLASS_NAME, _, GEN_INTERFACE_NAME, _mt), COBJ_PP_CONCAT(GEN_CLASS_NAME, _as_, GEN_INTERFACE_NAME)(GEN_OBJECT_POINTER))
+
 
 
 #endif /* COBJ_COMMON_H_ */
\ No newline at end of file
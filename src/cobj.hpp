@@ -0,0 +1,111 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef COBJ_HPP_
+#define COBJ_HPP_
+
+//////////////////////////////////////////////////////////////////////////
+// C++ layer (C++20)
+//
+//	If an interface or class header is included by C++ code, the generators specialize
+//	the templates below, from the same x-macros as the C code:
+//
+//	cobj::ref<gpio_pin>		a reference with inline methods, calling through the method-table
+//	cobj::ref<gpio_pin, hw_gpio_pin>	a reference to an object of a known class, calling
+//							through the constant method-table of the class
+//	cobj::interface_traits<gpio_pin>	name, descriptor and methods_count (constexpr)
+//	cobj::class_traits<hw_gpio_pin>		name and descriptor (constexpr)
+//	cobj::implements<hw_gpio_pin, gpio_pin>	concept, true if the class implements the interface
+//
+//	So the dispatch is chosen per call site:
+//
+//	template<cobj::implements<gpio_pin> T>
+//	void blink(T & pin_object)
+//	{
+//		cobj::ref<gpio_pin, T> pin(pin_object);		// static dispatch
+//		pin.toggle();
+//	}
+//
+//	void blink(cobj::ref<gpio_pin> pin)				// dynamic dispatch
+//	{
+//		pin.toggle();
+//	}
+//
+//	The classes are implemented in C, and the _impl methods are static. So the static
+//	dispatch calls through the method-table of the class: it isn't loaded from the reference,
+//	but the call is indirect, like the dynamic dispatch. Only if the program is built with
+//	link-time optimization (-flto), it's a direct call, with the thunk and the _impl method
+//	of the class inlined into the caller.
+
+#include <cstddef>
+
+#include "cobj.h"
+
+namespace cobj {
+
+	// specialized by the interface generator for each interface
+	template<class I> struct interface_traits;
+	
+	// specialized by the class generator for each class
+	template<class C> struct class_traits;
+	
+	// the method-table of class C for interface I, specialized by the class generator
+	// for each interface in COBJ_CLASS_INTERFACES
+	template<class C, class I> struct implementation;
+	
+	// the reference to interface I, to an object of any class (C = void), or of class C
+	template<class I, class C = void> class ref;
+	
+	template<class I>
+	concept interface = requires {
+		typename interface_traits<I>::mt_type;
+	};
+	
+	template<class C>
+	concept object = requires {
+		class_traits<C>::descriptor;
+	};
+	
+	template<class C, class I>
+	concept implements = object<C> && interface<I> && requires {
+		implementation<C, I>::mt;
+	};
+	
+	/*
+		Common Error:
+		template constraint failure for 'template<class C> requires implements<C, interface> class cobj::ref<interface, C>'
+
+		Cause:
+		The class doesn't implement the interface, or it implements a derived interface only
+		(COBJ_INTERFACE_EXTENDS).
+
+		Resolution:
+		Use the dynamic reference cobj::ref<interface>, or the derived interface.
+	*/
+}
+
+
+#endif /* COBJ_HPP_ */
@@ -30,6 +30,10 @@ SOFTWARE.
 //	COBJ_CLASS_NAME: The name of the class
 //	COBJ_CLASS_INTERFACES --> COBJ_CLASS_INTERFACE(GEN_INTERFACE_NAME): X-Macro for the implemented Interfaces
 //	COBJ_CLASS_VARIABLES --> COBJ_CLASS_VARIABLE(GEN_VARIABLE_SPEC): X-Macro for object private variables
+//		COBJ_CLASS_VARIABLE_COLD(GEN_VARIABLE_SPEC): rarely used variables, moved out of the object
+//	COBJ_CLASS_ALIGN: optional alignment of the objects
+//	COBJ_CLASS_REFCOUNTED: objects have a reference count, and the class implements finalize_impl
+//	COBJ_CLASS_LAZY: generates a proxy, which initializes the object on the first call
 //
 // Names defined:
 //	genclass_descriptor: Defines the name of the class-descriptor
@@ -58,5 +62,16 @@ SOFTWARE.
 #	define genclass_object genclass
 #	define genclass_object_impl COBJ_PP_CONCAT(genclass, _impl)
 #	define genclass_initialize COBJ_PP_CONCAT(genclass, _initialize)
+#	define genclass_cold COBJ_PP_CONCAT(genclass, _cold)
+#	define genclass_finalize COBJ_PP_CONCAT(genclass, _finalize)
+#	define genclass_parameters COBJ_PP_CONCAT(genclass, _parameters)
+#	define genclass_initialize_generic COBJ_PP_CONCAT(genclass, _initialize_generic)
+#	define genclass_lazy COBJ_PP_CONCAT(genclass, _lazy)
+#	define genclass_lazy_impl COBJ_PP_CONCAT(genclass, _lazy_impl)
+#	define genclass_lazy_initialize COBJ_PP_CONCAT(genclass, _lazy_initialize)
+#	define genclass_lazy_initialize_generic COBJ_PP_CONCAT(genclass, _lazy_initialize_generic)
+#	define genclass_lazy_resolve COBJ_PP_CONCAT(genclass, _lazy_resolve)
+#	define genclass_lazy_descriptor COBJ_PP_CONCAT(genclass, _lazy_descriptor)
+#	define genclass_lazy_descriptor_instance COBJ_PP_CONCAT(genclass, _lazy_descriptor_instance)
 
 #endif
@@ -0,0 +1,145 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+//////////////////////////////////////////////////////////////////////////
+// Generates the layout of the objects of COBJ_CLASS_NAME
+//
+//	This is included by the class generator, and by the interface generator in
+//	COBJ_INTERFACE_IMPLEMENTATION_MODE, because the thunks need the _impl struct
+//	already. So the code is only generated on the first #include, the class
+//	generator #undefs COBJPVT_GEN_CLASS_LAYOUT_GENERATED for the next class.
+//
+//	COBJ_CLASS_VARIABLES --> COBJ_CLASS_VARIABLE(GEN_VARIABLE_SPEC), COBJ_CLASS_VARIABLE_COLD(GEN_VARIABLE_SPEC)
+//	COBJ_CLASS_ALIGN: optional alignment of the objects
+//	COBJ_CLASS_REFCOUNTED: the reference count follows the class_descriptor
+//	COBJ_CLASS_LAZY: the proxy initializing the object on the first call
+//
+// Names defined:
+//	COBJPVT_GEN_CLASS_HAS_COLD: defined if there is any cold variable
+//	COBJPVT_GEN_CLASS_ALIGNAS: the alignment-specifier for the first member of the object
+//	genclass_cold: the struct for the cold variables
+//	genclass_object_impl: the strong typed object struct
+//	genclass_lazy_impl: the strong typed proxy struct, if COBJ_CLASS_LAZY is defined
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef COBJPVT_GEN_CLASS_LAYOUT_GENERATED
+#define COBJPVT_GEN_CLASS_LAYOUT_GENERATED
+
+#include "cobjpvt-generator-class-defines.h"
+#include "cobjpvt-generator-helper.h"
+
+#ifdef COBJ_CLASS_REFCOUNTED
+#	include "cobj-refcount.h"
+#endif
+
+#ifdef COBJ_CLASS_LAZY
+#	include "cobj-lazy.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// (1) check for cold variables
+#define COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)
+#define COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
+	+1
+#if (0 COBJPVT_GEN_CLASS_VARIABLE_GENERATOR()) > 0
+#	define COBJPVT_GEN_CLASS_HAS_COLD
+#endif
+#undef COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE
+#undef COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE
+
+//////////////////////////////////////////////////////////////////////////
+// (2) alignment
+#if defined(COBJ_CLASS_ALIGN) && defined(__cplusplus)
+#	define COBJPVT_GEN_CLASS_ALIGNAS alignas(COBJ_CLASS_ALIGN)
+#elif defined(COBJ_CLASS_ALIGN)
+#	define COBJPVT_GEN_CLASS_ALIGNAS _Alignas(COBJ_CLASS_ALIGN)
+#else
+#	define COBJPVT_GEN_CLASS_ALIGNAS
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// (3) the cold variables are moved into an own struct. The object links to it,
+//	the memory is provided to the initializer.
+#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+	typedef struct {
+		#define COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)
+		#define COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
+			GEN_VARIABLE_TYPE GEN_VARIABLE_NAME;
+		COBJPVT_GEN_CLASS_VARIABLE_GENERATOR()
+		#undef COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE
+		#undef COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE
+	} genclass_cold;
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// (4) strong typed implemenation object_struct
+//	The public object struct in cobj-classheader-generator.h must have the same layout!
+	typedef struct {
+		COBJPVT_GEN_CLASS_ALIGNAS cobj_class_descriptor * class_desriptor;
+		#ifdef COBJ_CLASS_REFCOUNTED
+			cobj_refcount refcount;
+		#endif
+		#define COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
+			GEN_VARIABLE_TYPE GEN_VARIABLE_NAME;
+		#define COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)
+		COBJPVT_GEN_CLASS_VARIABLE_GENERATOR()
+		#undef COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE
+		#undef COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE
+		#ifdef COBJPVT_GEN_CLASS_HAS_COLD
+			genclass_cold * cold;
+		#endif
+	} genclass_object_impl;
+
+//////////////////////////////////////////////////////////////////////////
+// (5) strong typed proxy of COBJ_CLASS_LAZY, the object is initialized by the first call
+//	The public proxy struct in cobj-classheader-generator.h starts with the same members,
+//	the link to the cold variables and the parameters follow the object.
+#ifdef COBJ_CLASS_LAZY
+	typedef struct {
+		const cobj_class_descriptor * class_desriptor;
+		cobj_lazy lazy;
+		genclass_object_impl target;
+	} genclass_lazy_impl;
+	
+	#ifdef COBJ_IMPLEMENTATION_FILE
+		// initializes the object, implemented by the class generator. Returns null, if it failed.
+		static cobj_object * lazy_resolve_target(genclass_lazy_impl * self);
+		
+		// the thunks of the proxy call the thunks of the class with the object
+		static inline cobj_object * lazy_target(cobj_object * object)
+		{
+			genclass_lazy_impl * self = (genclass_lazy_impl *)object;
+			
+			if(atomic_load_explicit(&self->lazy.state, memory_order_acquire) == cobj_lazy_state_initialized){
+				return (cobj_object *)&self->target;
+			}
+			
+			return lazy_resolve_target(self);
+		}
+	#endif
+#endif
+
+#endif
@@ -80,13 +80,72 @@ SOFTWARE.
 //			#undef COBJPVT_GEN_METHOD_TEMPLATE
 
 #define COBJPVT_GEN_INTERFACE_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, ...) \
+	COBJPVT_GEN_INTERFACE_METHOD_KIND(COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE, cobj_method_kind_regular, GEN_RETURN_TYPE, GEN_METHOD_NAME, __VA_ARGS__)
+
+//	COBJ_INTERFACE_PURE_METHOD, COBJ_INTERFACE_MUTATING_METHOD and COBJ_INTERFACE_SETTER_METHOD use their own
+//	capture templates, which are aliases of COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE by default. So only generators
+//	interested in the kind of the method (like the memo generator) see a difference.
+#define COBJPVT_GEN_INTERFACE_PURE_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, ...) \
+	COBJPVT_GEN_INTERFACE_METHOD_KIND(COBJPVT_GEN_PURE_METHOD_TEMPLATE, cobj_method_kind_pure, GEN_RETURN_TYPE, GEN_METHOD_NAME, __VA_ARGS__)
+
+#define COBJPVT_GEN_INTERFACE_MUTATING_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, ...) \
+	COBJPVT_GEN_INTERFACE_METHOD_KIND(COBJPVT_GEN_MUTATING_METHOD_TEMPLATE, cobj_method_kind_mutating, GEN_RETURN_TYPE, GEN_METHOD_NAME, __VA_ARGS__)
+
+#define COBJPVT_GEN_INTERFACE_SETTER_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, ...) \
+	COBJPVT_GEN_INTERFACE_METHOD_KIND(COBJPVT_GEN_SETTER_METHOD_TEMPLATE, cobj_method_kind_setter, GEN_RETURN_TYPE, GEN_METHOD_NAME, __VA_ARGS__)
+
+#define COBJPVT_GEN_INTERFACE_METHOD_KIND(GEN_CAPTURE_TEMPLATE, GEN_METHOD_KIND, GEN_RETURN_TYPE, GEN_METHOD_NAME, ...) \
 	COBJPVT_GEN_METHOD_TEMPLATE(	\
 		/*GEN_RETURN_STATEMENT*/ COBJPVT_RETURN_STATMENT(GEN_RETURN_TYPE),	\
 		GEN_RETURN_TYPE,						\
 		GEN_METHOD_NAME,						\
 		/*GEN_ARGS_SEPERATOR*/	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_SEPERATOR_, COBJPVT_PP_NARG(__VA_ARGS__)), \
 		/*GEN_ARGS_SIGNATURE*/	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_SIGNATURE_, COBJPVT_PP_NARG(__VA_ARGS__))(__VA_ARGS__), \
-		/*GEN_ARGS_NAMES*/		COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_NAME_, COBJPVT_PP_NARG(__VA_ARGS__))( __VA_ARGS__))
+		/*GEN_ARGS_NAMES*/		COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_NAME_, COBJPVT_PP_NARG(__VA_ARGS__))( __VA_ARGS__))	\
+	GEN_CAPTURE_TEMPLATE(	\
+		/*GEN_RETURN_STATEMENT*/ COBJPVT_RETURN_STATMENT(GEN_RETURN_TYPE),	\
+		GEN_RETURN_TYPE,						\
+		GEN_METHOD_NAME,						\
+		/*GEN_ARGS_SEPERATOR*/	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_SEPERATOR_, COBJPVT_PP_NARG(__VA_ARGS__)), \
+		/*GEN_ARGS_SIGNATURE*/	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_SIGNATURE_, COBJPVT_PP_NARG(__VA_ARGS__))(__VA_ARGS__), \
+		/*GEN_ARGS_NAMES*/		COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_NAME_, COBJPVT_PP_NARG(__VA_ARGS__))( __VA_ARGS__), \
+		/*GEN_ARGS_MEMBERS*/	COBJPVT_GEN_METHOD_ARGS_MEMBERS(__VA_ARGS__),	\
+		/*GEN_ARGS_STORE*/		COBJPVT_GEN_METHOD_ARGS_STORE(__VA_ARGS__),	\
+		/*GEN_ARGS_LOAD*/		COBJPVT_GEN_METHOD_ARGS_LOAD(__VA_ARGS__))	\
+	COBJPVT_GEN_METHOD_REFLECT_TEMPLATE(	\
+		GEN_METHOD_KIND,	\
+		/*GEN_RETURN_STATEMENT*/ COBJPVT_RETURN_STATMENT(GEN_RETURN_TYPE),	\
+		GEN_RETURN_TYPE,						\
+		GEN_METHOD_NAME,						\
+		/*GEN_ARGS_SEPERATOR*/	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_SEPERATOR_, COBJPVT_PP_NARG(__VA_ARGS__)), \
+		/*GEN_ARGS_SIGNATURE*/	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_SIGNATURE_, COBJPVT_PP_NARG(__VA_ARGS__))(__VA_ARGS__), \
+		/*GEN_ARGS_NAMES*/		COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_NAME_, COBJPVT_PP_NARG(__VA_ARGS__))( __VA_ARGS__), \
+		/*GEN_ARGS_MEMBERS*/	COBJPVT_GEN_METHOD_ARGS_MEMBERS(__VA_ARGS__),	\
+		/*GEN_ARGS_STORE*/		COBJPVT_GEN_METHOD_ARGS_STORE(__VA_ARGS__),	\
+		/*GEN_ARGS_LOAD*/		COBJPVT_GEN_METHOD_ARGS_LOAD(__VA_ARGS__),	\
+		/*GEN_ARGS_LIST*/		(__VA_ARGS__))
+
+//	Generators capturing the arguments of calls into structs (like messages) define the
+//	COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE instead of COBJPVT_GEN_METHOD_TEMPLATE, and restore the empty
+//	default afterwards. It has the arguments of COBJPVT_GEN_METHOD_TEMPLATE, and:
+//		* GEN_ARGS_MEMBERS: the arguments as struct members, like "int a; int b;"
+//		* GEN_ARGS_STORE: stores the arguments into the struct pointed to by "frame", like "frame->a = a; frame->b = b;"
+//		* GEN_ARGS_LOAD: the arguments loaded from the struct pointed to by "frame", like "frame->a, frame->b"
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+
+//	The names of the capture templates of pure and mutating methods, generators define them like
+//	COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE, and restore the defaults afterwards
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE		COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#define COBJPVT_GEN_MUTATING_METHOD_TEMPLATE	COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+
+//	setters are mutating methods, for generators not interested in setters
+#define COBJPVT_GEN_SETTER_METHOD_TEMPLATE		COBJPVT_GEN_MUTATING_METHOD_TEMPLATE
+
+//	The reflection (in the interface registry) defines COBJPVT_GEN_METHOD_REFLECT_TEMPLATE, and restores the empty
+//	default afterwards. It has the kind of the method (cobj_method_kind), the arguments of
+//	COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE, and:
+//		* GEN_ARGS_LIST: the arguments as passed to the method, in parenthesis, like "(int, a, int, b)"
+#define COBJPVT_GEN_METHOD_REFLECT_TEMPLATE(GEN_METHOD_KIND, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD, GEN_ARGS_LIST)
 
 
 #define COBJPVT_GEN_METHOD_ARGS_SEPERATOR_0
@@ -207,6 +266,254 @@ SOFTWARE.
 
 #define COBJPVT_GEN_METHOD_ARGS_NAME_0()
 
+//	struct members for the arguments, like "int a; int b;". Used for structs capturing the arguments of a call
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS(...)	\
+	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_MEMBERS_, COBJPVT_PP_NARG(__VA_ARGS__))(__VA_ARGS__)
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_32(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13, GEN_ARGT_14, GEN_ARGN_14, GEN_ARGT_15, GEN_ARGN_15)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04; GEN_ARGT_05 GEN_ARGN_05; GEN_ARGT_06 GEN_ARGN_06; GEN_ARGT_07 GEN_ARGN_07; GEN_ARGT_08 GEN_ARGN_08; GEN_ARGT_09 GEN_ARGN_09; GEN_ARGT_10 GEN_ARGN_10; GEN_ARGT_11 GEN_ARGN_11; GEN_ARGT_12 GEN_ARGN_12; GEN_ARGT_13 GEN_ARGN_13; GEN_ARGT_14 GEN_ARGN_14; GEN_ARGT_15 GEN_ARGN_15;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_30(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13, GEN_ARGT_14, GEN_ARGN_14)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04; GEN_ARGT_05 GEN_ARGN_05; GEN_ARGT_06 GEN_ARGN_06; GEN_ARGT_07 GEN_ARGN_07; GEN_ARGT_08 GEN_ARGN_08; GEN_ARGT_09 GEN_ARGN_09; GEN_ARGT_10 GEN_ARGN_10; GEN_ARGT_11 GEN_ARGN_11; GEN_ARGT_12 GEN_ARGN_12; GEN_ARGT_13 GEN_ARGN_13; GEN_ARGT_14 GEN_ARGN_14;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_28(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04; GEN_ARGT_05 GEN_ARGN_05; GEN_ARGT_06 GEN_ARGN_06; GEN_ARGT_07 GEN_ARGN_07; GEN_ARGT_08 GEN_ARGN_08; GEN_ARGT_09 GEN_ARGN_09; GEN_ARGT_10 GEN_ARGN_10; GEN_ARGT_11 GEN_ARGN_11; GEN_ARGT_12 GEN_ARGN_12; GEN_ARGT_13 GEN_ARGN_13;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_26(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04; GEN_ARGT_05 GEN_ARGN_05; GEN_ARGT_06 GEN_ARGN_06; GEN_ARGT_07 GEN_ARGN_07; GEN_ARGT_08 GEN_ARGN_08; GEN_ARGT_09 GEN_ARGN_09; GEN_ARGT_10 GEN_ARGN_10; GEN_ARGT_11 GEN_ARGN_11; GEN_ARGT_12 GEN_ARGN_12;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_24(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04; GEN_ARGT_05 GEN_ARGN_05; GEN_ARGT_06 GEN_ARGN_06; GEN_ARGT_07 GEN_ARGN_07; GEN_ARGT_08 GEN_ARGN_08; GEN_ARGT_09 GEN_ARGN_09; GEN_ARGT_10 GEN_ARGN_10; GEN_ARGT_11 GEN_ARGN_11;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_22(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04; GEN_ARGT_05 GEN_ARGN_05; GEN_ARGT_06 GEN_ARGN_06; GEN_ARGT_07 GEN_ARGN_07; GEN_ARGT_08 GEN_ARGN_08; GEN_ARGT_09 GEN_ARGN_09; GEN_ARGT_10 GEN_ARGN_10;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_20(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04; GEN_ARGT_05 GEN_ARGN_05; GEN_ARGT_06 GEN_ARGN_06; GEN_ARGT_07 GEN_ARGN_07; GEN_ARGT_08 GEN_ARGN_08; GEN_ARGT_09 GEN_ARGN_09;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_18(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04; GEN_ARGT_05 GEN_ARGN_05; GEN_ARGT_06 GEN_ARGN_06; GEN_ARGT_07 GEN_ARGN_07; GEN_ARGT_08 GEN_ARGN_08;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_16(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04; GEN_ARGT_05 GEN_ARGN_05; GEN_ARGT_06 GEN_ARGN_06; GEN_ARGT_07 GEN_ARGN_07;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_14(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04; GEN_ARGT_05 GEN_ARGN_05; GEN_ARGT_06 GEN_ARGN_06;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_12(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04; GEN_ARGT_05 GEN_ARGN_05;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_10(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03; GEN_ARGT_04 GEN_ARGN_04;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_8(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02; GEN_ARGT_03 GEN_ARGN_03;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_6(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01; GEN_ARGT_02 GEN_ARGN_02;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_4(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01)	\
+	GEN_ARGT_00 GEN_ARGN_00; GEN_ARGT_01 GEN_ARGN_01;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_2(GEN_ARGT_00, GEN_ARGN_00)	\
+	GEN_ARGT_00 GEN_ARGN_00;
+
+#define COBJPVT_GEN_METHOD_ARGS_MEMBERS_0()
+
+//	stores the arguments into the members of "frame", like "frame->a = a; frame->b = b;"
+#define COBJPVT_GEN_METHOD_ARGS_STORE(...)	\
+	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_STORE_, COBJPVT_PP_NARG(__VA_ARGS__))(__VA_ARGS__)
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_32(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13, GEN_ARGT_14, GEN_ARGN_14, GEN_ARGT_15, GEN_ARGN_15)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04; frame->GEN_ARGN_05 = GEN_ARGN_05; frame->GEN_ARGN_06 = GEN_ARGN_06; frame->GEN_ARGN_07 = GEN_ARGN_07; frame->GEN_ARGN_08 = GEN_ARGN_08; frame->GEN_ARGN_09 = GEN_ARGN_09; frame->GEN_ARGN_10 = GEN_ARGN_10; frame->GEN_ARGN_11 = GEN_ARGN_11; frame->GEN_ARGN_12 = GEN_ARGN_12; frame->GEN_ARGN_13 = GEN_ARGN_13; frame->GEN_ARGN_14 = GEN_ARGN_14; frame->GEN_ARGN_15 = GEN_ARGN_15;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_30(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13, GEN_ARGT_14, GEN_ARGN_14)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04; frame->GEN_ARGN_05 = GEN_ARGN_05; frame->GEN_ARGN_06 = GEN_ARGN_06; frame->GEN_ARGN_07 = GEN_ARGN_07; frame->GEN_ARGN_08 = GEN_ARGN_08; frame->GEN_ARGN_09 = GEN_ARGN_09; frame->GEN_ARGN_10 = GEN_ARGN_10; frame->GEN_ARGN_11 = GEN_ARGN_11; frame->GEN_ARGN_12 = GEN_ARGN_12; frame->GEN_ARGN_13 = GEN_ARGN_13; frame->GEN_ARGN_14 = GEN_ARGN_14;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_28(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04; frame->GEN_ARGN_05 = GEN_ARGN_05; frame->GEN_ARGN_06 = GEN_ARGN_06; frame->GEN_ARGN_07 = GEN_ARGN_07; frame->GEN_ARGN_08 = GEN_ARGN_08; frame->GEN_ARGN_09 = GEN_ARGN_09; frame->GEN_ARGN_10 = GEN_ARGN_10; frame->GEN_ARGN_11 = GEN_ARGN_11; frame->GEN_ARGN_12 = GEN_ARGN_12; frame->GEN_ARGN_13 = GEN_ARGN_13;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_26(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04; frame->GEN_ARGN_05 = GEN_ARGN_05; frame->GEN_ARGN_06 = GEN_ARGN_06; frame->GEN_ARGN_07 = GEN_ARGN_07; frame->GEN_ARGN_08 = GEN_ARGN_08; frame->GEN_ARGN_09 = GEN_ARGN_09; frame->GEN_ARGN_10 = GEN_ARGN_10; frame->GEN_ARGN_11 = GEN_ARGN_11; frame->GEN_ARGN_12 = GEN_ARGN_12;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_24(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04; frame->GEN_ARGN_05 = GEN_ARGN_05; frame->GEN_ARGN_06 = GEN_ARGN_06; frame->GEN_ARGN_07 = GEN_ARGN_07; frame->GEN_ARGN_08 = GEN_ARGN_08; frame->GEN_ARGN_09 = GEN_ARGN_09; frame->GEN_ARGN_10 = GEN_ARGN_10; frame->GEN_ARGN_11 = GEN_ARGN_11;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_22(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04; frame->GEN_ARGN_05 = GEN_ARGN_05; frame->GEN_ARGN_06 = GEN_ARGN_06; frame->GEN_ARGN_07 = GEN_ARGN_07; frame->GEN_ARGN_08 = GEN_ARGN_08; frame->GEN_ARGN_09 = GEN_ARGN_09; frame->GEN_ARGN_10 = GEN_ARGN_10;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_20(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04; frame->GEN_ARGN_05 = GEN_ARGN_05; frame->GEN_ARGN_06 = GEN_ARGN_06; frame->GEN_ARGN_07 = GEN_ARGN_07; frame->GEN_ARGN_08 = GEN_ARGN_08; frame->GEN_ARGN_09 = GEN_ARGN_09;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_18(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04; frame->GEN_ARGN_05 = GEN_ARGN_05; frame->GEN_ARGN_06 = GEN_ARGN_06; frame->GEN_ARGN_07 = GEN_ARGN_07; frame->GEN_ARGN_08 = GEN_ARGN_08;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_16(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04; frame->GEN_ARGN_05 = GEN_ARGN_05; frame->GEN_ARGN_06 = GEN_ARGN_06; frame->GEN_ARGN_07 = GEN_ARGN_07;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_14(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04; frame->GEN_ARGN_05 = GEN_ARGN_05; frame->GEN_ARGN_06 = GEN_ARGN_06;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_12(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04; frame->GEN_ARGN_05 = GEN_ARGN_05;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_10(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03; frame->GEN_ARGN_04 = GEN_ARGN_04;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_8(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02; frame->GEN_ARGN_03 = GEN_ARGN_03;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_6(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01; frame->GEN_ARGN_02 = GEN_ARGN_02;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_4(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00; frame->GEN_ARGN_01 = GEN_ARGN_01;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_2(GEN_ARGT_00, GEN_ARGN_00)	\
+	frame->GEN_ARGN_00 = GEN_ARGN_00;
+
+#define COBJPVT_GEN_METHOD_ARGS_STORE_0()
+
+//	the arguments loaded from the members of "frame", like "frame->a, frame->b"
+#define COBJPVT_GEN_METHOD_ARGS_LOAD(...)	\
+	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_LOAD_, COBJPVT_PP_NARG(__VA_ARGS__))(__VA_ARGS__)
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_32(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13, GEN_ARGT_14, GEN_ARGN_14, GEN_ARGT_15, GEN_ARGN_15)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04, frame->GEN_ARGN_05, frame->GEN_ARGN_06, frame->GEN_ARGN_07, frame->GEN_ARGN_08, frame->GEN_ARGN_09, frame->GEN_ARGN_10, frame->GEN_ARGN_11, frame->GEN_ARGN_12, frame->GEN_ARGN_13, frame->GEN_ARGN_14, frame->GEN_ARGN_15
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_30(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13, GEN_ARGT_14, GEN_ARGN_14)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04, frame->GEN_ARGN_05, frame->GEN_ARGN_06, frame->GEN_ARGN_07, frame->GEN_ARGN_08, frame->GEN_ARGN_09, frame->GEN_ARGN_10, frame->GEN_ARGN_11, frame->GEN_ARGN_12, frame->GEN_ARGN_13, frame->GEN_ARGN_14
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_28(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04, frame->GEN_ARGN_05, frame->GEN_ARGN_06, frame->GEN_ARGN_07, frame->GEN_ARGN_08, frame->GEN_ARGN_09, frame->GEN_ARGN_10, frame->GEN_ARGN_11, frame->GEN_ARGN_12, frame->GEN_ARGN_13
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_26(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04, frame->GEN_ARGN_05, frame->GEN_ARGN_06, frame->GEN_ARGN_07, frame->GEN_ARGN_08, frame->GEN_ARGN_09, frame->GEN_ARGN_10, frame->GEN_ARGN_11, frame->GEN_ARGN_12
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_24(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04, frame->GEN_ARGN_05, frame->GEN_ARGN_06, frame->GEN_ARGN_07, frame->GEN_ARGN_08, frame->GEN_ARGN_09, frame->GEN_ARGN_10, frame->GEN_ARGN_11
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_22(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04, frame->GEN_ARGN_05, frame->GEN_ARGN_06, frame->GEN_ARGN_07, frame->GEN_ARGN_08, frame->GEN_ARGN_09, frame->GEN_ARGN_10
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_20(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04, frame->GEN_ARGN_05, frame->GEN_ARGN_06, frame->GEN_ARGN_07, frame->GEN_ARGN_08, frame->GEN_ARGN_09
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_18(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04, frame->GEN_ARGN_05, frame->GEN_ARGN_06, frame->GEN_ARGN_07, frame->GEN_ARGN_08
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_16(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04, frame->GEN_ARGN_05, frame->GEN_ARGN_06, frame->GEN_ARGN_07
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_14(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04, frame->GEN_ARGN_05, frame->GEN_ARGN_06
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_12(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04, frame->GEN_ARGN_05
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_10(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03, frame->GEN_ARGN_04
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_8(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02, frame->GEN_ARGN_03
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_6(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01, frame->GEN_ARGN_02
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_4(GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01)	\
+	frame->GEN_ARGN_00, frame->GEN_ARGN_01
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_2(GEN_ARGT_00, GEN_ARGN_00)	\
+	frame->GEN_ARGN_00
+
+#define COBJPVT_GEN_METHOD_ARGS_LOAD_0()
+
+//	initializers of the cobj_argument_descriptor of the arguments, with the offsets in the struct GEN_STRUCT holding them.
+//	Like "{ \"int\", \"a\", sizeof(int), offsetof(GEN_STRUCT, a) }, ..."
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS(GEN_STRUCT, ...)	\
+	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_, COBJPVT_PP_NARG(__VA_ARGS__))(GEN_STRUCT, __VA_ARGS__)
+
+#define COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT, GEN_ARGN)	\
+	{ #GEN_ARGT, #GEN_ARGN, sizeof(GEN_ARGT), offsetof(GEN_STRUCT, GEN_ARGN) },
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_32(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13, GEN_ARGT_14, GEN_ARGN_14, GEN_ARGT_15, GEN_ARGN_15)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_05, GEN_ARGN_05) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_06, GEN_ARGN_06) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_07, GEN_ARGN_07) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_08, GEN_ARGN_08) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_09, GEN_ARGN_09) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_10, GEN_ARGN_10) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_11, GEN_ARGN_11) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_12, GEN_ARGN_12) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_13, GEN_ARGN_13) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_14, GEN_ARGN_14) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_15, GEN_ARGN_15)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_30(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13, GEN_ARGT_14, GEN_ARGN_14)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_05, GEN_ARGN_05) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_06, GEN_ARGN_06) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_07, GEN_ARGN_07) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_08, GEN_ARGN_08) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_09, GEN_ARGN_09) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_10, GEN_ARGN_10) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_11, GEN_ARGN_11) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_12, GEN_ARGN_12) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_13, GEN_ARGN_13) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_14, GEN_ARGN_14)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_28(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12, GEN_ARGT_13, GEN_ARGN_13)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_05, GEN_ARGN_05) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_06, GEN_ARGN_06) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_07, GEN_ARGN_07) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_08, GEN_ARGN_08) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_09, GEN_ARGN_09) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_10, GEN_ARGN_10) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_11, GEN_ARGN_11) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_12, GEN_ARGN_12) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_13, GEN_ARGN_13)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_26(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11, GEN_ARGT_12, GEN_ARGN_12)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_05, GEN_ARGN_05) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_06, GEN_ARGN_06) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_07, GEN_ARGN_07) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_08, GEN_ARGN_08) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_09, GEN_ARGN_09) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_10, GEN_ARGN_10) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_11, GEN_ARGN_11) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_12, GEN_ARGN_12)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_24(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10, GEN_ARGT_11, GEN_ARGN_11)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_05, GEN_ARGN_05) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_06, GEN_ARGN_06) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_07, GEN_ARGN_07) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_08, GEN_ARGN_08) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_09, GEN_ARGN_09) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_10, GEN_ARGN_10) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_11, GEN_ARGN_11)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_22(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09, GEN_ARGT_10, GEN_ARGN_10)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_05, GEN_ARGN_05) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_06, GEN_ARGN_06) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_07, GEN_ARGN_07) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_08, GEN_ARGN_08) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_09, GEN_ARGN_09) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_10, GEN_ARGN_10)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_20(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08, GEN_ARGT_09, GEN_ARGN_09)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_05, GEN_ARGN_05) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_06, GEN_ARGN_06) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_07, GEN_ARGN_07) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_08, GEN_ARGN_08) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_09, GEN_ARGN_09)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_18(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07, GEN_ARGT_08, GEN_ARGN_08)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_05, GEN_ARGN_05) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_06, GEN_ARGN_06) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_07, GEN_ARGN_07) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_08, GEN_ARGN_08)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_16(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06, GEN_ARGT_07, GEN_ARGN_07)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_05, GEN_ARGN_05) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_06, GEN_ARGN_06) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_07, GEN_ARGN_07)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_14(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05, GEN_ARGT_06, GEN_ARGN_06)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_05, GEN_ARGN_05) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_06, GEN_ARGN_06)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_12(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04, GEN_ARGT_05, GEN_ARGN_05)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_05, GEN_ARGN_05)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_10(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03, GEN_ARGT_04, GEN_ARGN_04)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_04, GEN_ARGN_04)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_8(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02, GEN_ARGT_03, GEN_ARGN_03)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_03, GEN_ARGN_03)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_6(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01, GEN_ARGT_02, GEN_ARGN_02)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_02, GEN_ARGN_02)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_4(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00, GEN_ARGT_01, GEN_ARGN_01)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00) COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_01, GEN_ARGN_01)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_2(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00)	\
+	COBJPVT_GEN_METHOD_ARG_DESCRIPTOR(GEN_STRUCT, GEN_ARGT_00, GEN_ARGN_00)
+
+#define COBJPVT_GEN_METHOD_ARGS_DESCRIPTORS_0(GEN_STRUCT, ...)
+
+//////////////////////////////////////////////////////////////////////////
+//	Async-Methods Generation
+//	COBJ_INTERFACE_ASYNC_METHOD expands to COBJPVT_GEN_ASYNC_METHOD_TEMPLATE, which generates the frame,
+//	and to a regular method NAME_poll, taking the frame. The template is empty, except when the interface
+//	generator generates the frames. So all other generators only see the _poll method.
+//		* GEN_ARGS_MEMBERS: the arguments as struct members, like "int a; int b;"
+//		* GEN_ARGS_STORE: stores the arguments into the frame, like "frame->a = a; frame->b = b;"
+#define COBJPVT_GEN_INTERFACE_ASYNC_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, ...)	\
+	COBJPVT_GEN_ASYNC_METHOD_TEMPLATE(	\
+		/*GEN_RETURN_STATEMENT*/ COBJPVT_RETURN_STATMENT(GEN_RETURN_TYPE),	\
+		GEN_RETURN_TYPE,						\
+		GEN_METHOD_NAME,						\
+		/*GEN_ARGS_SEPERATOR*/	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_SEPERATOR_, COBJPVT_PP_NARG(__VA_ARGS__)), \
+		/*GEN_ARGS_SIGNATURE*/	COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_SIGNATURE_, COBJPVT_PP_NARG(__VA_ARGS__))(__VA_ARGS__), \
+		/*GEN_ARGS_NAMES*/		COBJ_PP_CONCAT(COBJPVT_GEN_METHOD_ARGS_NAME_, COBJPVT_PP_NARG(__VA_ARGS__))( __VA_ARGS__), \
+		/*GEN_ARGS_MEMBERS*/	COBJPVT_GEN_METHOD_ARGS_MEMBERS(__VA_ARGS__),	\
+		/*GEN_ARGS_STORE*/		COBJPVT_GEN_METHOD_ARGS_STORE(__VA_ARGS__))	\
+	COBJPVT_GEN_INTERFACE_METHOD(cobj_async_status, GEN_METHOD_NAME ## _poll, COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHOD_NAME, _frame) *, frame)
+
+#define COBJPVT_GEN_ASYNC_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE)
+
+//	the result member of a frame, if the method doesn't return void
+#define COBJPVT_GEN_ASYNC_RESULT(GEN_RETURN_TYPE)	\
+	COBJ_PP_CONCAT(COBJPVT_GEN_ASYNC_RESULT_, COBJPVT_HLP_LST_COUNT(GEN_RETURN_TYPE))(GEN_RETURN_TYPE)
+#define COBJPVT_GEN_ASYNC_RESULT_0(GEN_RETURN_TYPE)
+#define COBJPVT_GEN_ASYNC_RESULT_1(GEN_RETURN_TYPE)	\
+	GEN_RETURN_TYPE result;
+
 #define COBJPVT_RETURN_STATMENT(GEN_RETURN_TYPE)	\
 	COBJ_PP_CONCAT(COBJPVT_HLP_IS_VOID_, COBJPVT_HLP_LST_COUNT(GEN_RETURN_TYPE))
 	
@@ -226,6 +533,8 @@ SOFTWARE.
 //	This macros defines the naming of the variables
 #define COBJPVT_GEN_CLASS_VARIABLE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
 	COBJPVT_GEN_CLASS_VARIABLE_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)
+#define COBJPVT_GEN_CLASS_VARIABLE_COLD(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
+	COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,7 @@ SOFTWARE.
 #ifndef COBJPVT_GEN_BASE_H_
 #define COBJPVT_GEN_BASE_H_
 
+#include <stdint.h>
 #include "cobjpvt-generator-framework.h"
 
 //////////////////////////////////////////////////////////////////////////
@@ -48,15 +49,177 @@ SOFTWARE.
 #define COBJ_INTERFACE_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, ...)	\
 	COBJPVT_GEN_INTERFACE_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, __VA_ARGS__)
 
+/*! \brief Defines an async method of an interface
+ *		\param GEN_RETURN_TYPE the type of the result
+ *		\param GEN_METHOD_NAME the name of the method
+ *		\param ... 0-15 arguments of the function in the format: argType1, argName1, ... argType15, argName15
+ *
+ *  The method is implemented as a stackless coroutine (see cobj-async.h). The generator emits
+ *  the frame struct INTERFACE_METHOD_frame, holding the state, the arguments and the result,
+ *  INTERFACE_METHOD_start to begin a call, and the method METHOD_poll to resume it.
+ *  
+ *  #define COBJ_INTERFACE_METHODS	\
+ *		COBJ_INTERFACE_ASYNC_METHOD(size_t, read, char *, buffer, size_t, length)
+ */
+#define COBJ_INTERFACE_ASYNC_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, ...)	\
+	COBJPVT_GEN_INTERFACE_ASYNC_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, __VA_ARGS__)
+
+/*! \brief Defines a pure method of an interface
+ *		\param GEN_RETURN_TYPE the return type of the method
+ *		\param GEN_METHOD_NAME the name of the method
+ *		\param ... 0-15 arguments of the function in the format: argType1, argName1, ... argType15, argName15
+ *
+ *  The result of a pure method only depends on it's arguments, and on the state changed by the
+ *  mutating methods of the interface. For all generators it's a regular method, except for the
+ *  memo generator (see COBJ_INTERFACE_MEMO_MODE), which caches the results.
+ *  
+ *  #define COBJ_INTERFACE_METHODS	\
+ *		COBJ_INTERFACE_PURE_METHOD(bool, get_value)	\
+ *		COBJ_INTERFACE_MUTATING_METHOD(void, set_value, bool, value)
+ */
+#define COBJ_INTERFACE_PURE_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, ...)	\
+	COBJPVT_GEN_INTERFACE_PURE_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, __VA_ARGS__)
+
+/*! \brief Defines a mutating method of an interface
+ *		\param GEN_RETURN_TYPE the return type of the method
+ *		\param GEN_METHOD_NAME the name of the method
+ *		\param ... 0-15 arguments of the function in the format: argType1, argName1, ... argType15, argName15
+ *
+ *  A mutating method changes the state the pure methods depend on, so it invalidates the results
+ *  cached by the memo generator.
+ */
+#define COBJ_INTERFACE_MUTATING_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, ...)	\
+	COBJPVT_GEN_INTERFACE_MUTATING_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, __VA_ARGS__)
+
+/*! \brief Defines a setter of an interface
+ *		\param GEN_RETURN_TYPE the return type of the method
+ *		\param GEN_METHOD_NAME the name of the method
+ *		\param ... 0-15 arguments of the function in the format: argType1, argName1, ... argType15, argName15
+ *
+ *  A setter is a mutating method, whose effect is replaced by the next call of the same method (like
+ *  set_value). So the cmdbuf generator (see cobj-cmdbuf.h) keeps only the last of consecutive calls.
+ */
+#define COBJ_INTERFACE_SETTER_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, ...)	\
+	COBJPVT_GEN_INTERFACE_SETTER_METHOD(GEN_RETURN_TYPE, GEN_METHOD_NAME, __VA_ARGS__)
+
 #define COBJPVT_GEN_METHOD_GENERATOR() \
 	COBJ_INTERFACE_METHODS
+
+//	The methods of the base interface (COBJ_INTERFACE_EXTENDS) are expanded from the
+//	NAME_methods x-macro of the base. This needs an own concat macro, because
+//	COBJ_PP_CONCAT is used within COBJ_INTERFACE_METHOD, and would not be expanded again.
+#define COBJPVT_GEN_BASE_METHOD_GENERATOR()	\
+	COBJPVT_GEN_BASE_METHOD_GENERATOR_HLP(COBJ_INTERFACE_EXTENDS)
+#define COBJPVT_GEN_BASE_METHOD_GENERATOR_HLP(GEN_INTERFACE_NAME)	\
+	COBJPVT_GEN_BASE_METHOD_GENERATOR_HLP2(GEN_INTERFACE_NAME)
+#define COBJPVT_GEN_BASE_METHOD_GENERATOR_HLP2(GEN_INTERFACE_NAME)	\
+	GEN_INTERFACE_NAME ## _methods
 	
+//	Profile-guided devirtualization (see cobj-profile.h)
+//	COBJPVT_GEN_PROFILE_SELECT(GEN_METHODNAME, PREFIX) selects PREFIX_1, if the profile names a class
+//	for the method (#define COBJ_PROFILE_interface_method (class)), else PREFIX_0.
+//	The selected macro is called with (profile, GEN_METHODNAME, GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, (GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE), (GEN_ARGS_SEPERATOR GEN_ARGS_NAME)),
+//	the argument lists are passed in parenthesis, because they contain commas.
+#define COBJPVT_GEN_PROFILE(GEN_METHODNAME)	\
+	COBJ_PP_CONCAT(COBJ_PROFILE_, COBJ_INTERFACE_NAME, _, GEN_METHODNAME)
+#define COBJPVT_GEN_PROFILE_SELECT(GEN_METHODNAME, GEN_PREFIX)	\
+	COBJPVT_GEN_PROFILE_SELECT_HLP(GEN_PREFIX, COBJPVT_PP_IS_PAREN(COBJPVT_GEN_PROFILE(GEN_METHODNAME)))
+#define COBJPVT_GEN_PROFILE_SELECT_HLP(GEN_PREFIX, GEN_PROFILED)	\
+	COBJPVT_GEN_PROFILE_SELECT_HLP2(GEN_PREFIX, GEN_PROFILED)
+#define COBJPVT_GEN_PROFILE_SELECT_HLP2(GEN_PREFIX, GEN_PROFILED)	\
+	GEN_PREFIX ## _ ## GEN_PROFILED
+
+//	the thunk of the class the method is devirtualized to
+#define COBJPVT_GEN_PROFILE_THUNK(GEN_PROFILE, GEN_METHODNAME)	\
+	COBJ_PP_CONCAT(COBJPVT_PP_REMOVE_PARENS(GEN_PROFILE), _, COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _thunk)
+
+//	the index of a method in the mt. The methods of the base are found at COBJ_INTERFACE_EXTENDS.method.
+#define COBJPVT_GEN_METHOD_INDEX(GEN_MT, GEN_MEMBER)	\
+	((uint32_t)(offsetof(GEN_MT, GEN_MEMBER) / sizeof(void (*)(void))))
+
+//	Decorators, the classes generated for an interface (see cobj-remote.h, cobj-record.h, cobj-cmdbuf.h,
+//	cobj-synchronized.h and the memo). The generator #defines COBJPVT_GEN_DECORATOR as the name of the class
+//	(like proxy), and implements the thunk INTERFACE_DECORATOR_METHOD_thunk for the methods of the interface
+//	and it's base.
+#define COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, COBJPVT_GEN_DECORATOR, _, GEN_METHODNAME, _thunk)
+#define COBJPVT_GEN_DECORATOR_DESCRIPTOR	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, COBJPVT_GEN_DECORATOR, _descriptor_instance)
+
+//	a call written as message is identified by INTERFACE_METHOD_method_index
+#define COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _method_index)
+
+//	COBJPVT_GEN_DECORATOR_CLASS(GEN_OBJECT_TYPE) generates the mt, queryinterface and the class descriptor
+//	of the decorator. It implements the interface, and it's bases. It's expanded while COBJPVT_GEN_METHOD_TEMPLATE
+//	is COBJPVT_GEN_DECORATOR_MT_TEMPLATE, the initialize function of the decorator sets the descriptor.
+#define COBJPVT_GEN_DECORATOR_MT_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+	.GEN_METHODNAME = &COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME),
+
+#define COBJPVT_GEN_DECORATOR_CLASS(GEN_OBJECT_TYPE)	\
+	static const geninterface_mt COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, COBJPVT_GEN_DECORATOR, _mt) = {	\
+		COBJPVT_GEN_BASE_MT_INITIALIZER()	\
+		COBJPVT_GEN_METHOD_GENERATOR()	\
+	};	\
+	static cobj_mt COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, COBJPVT_GEN_DECORATOR, _queryinterface)(const cobj_interface_descriptor * interface) {	\
+		if(cobj_interface_is_compatible(geninterface_descriptor, interface)){	\
+			return (cobj_mt)&COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, COBJPVT_GEN_DECORATOR, _mt);	\
+		}	\
+		return (cobj_mt)0;	\
+	}	\
+	static const cobj_class_descriptor COBJPVT_GEN_DECORATOR_DESCRIPTOR = {	\
+		.class_name = COBJPVT_PP_STRINGIFY(COBJ_INTERFACE_NAME) "_" COBJPVT_PP_STRINGIFY(COBJPVT_GEN_DECORATOR),	\
+		.queryinterface = &COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, COBJPVT_GEN_DECORATOR, _queryinterface),	\
+		.object_size = sizeof(GEN_OBJECT_TYPE),	\
+		.object_alignment = _Alignof(GEN_OBJECT_TYPE),	\
+	};
+
+//	COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, GEN_PREFIX) selects GEN_PREFIX_0 for methods returning void,
+//	else GEN_PREFIX_1. This needs an own concat macro, because the selected macros use COBJ_PP_CONCAT.
+#define COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, GEN_PREFIX)	\
+	COBJPVT_GEN_RESULT_SELECT_HLP(GEN_PREFIX, COBJPVT_HLP_LST_COUNT(GEN_RETURN_TYPE))
+#define COBJPVT_GEN_RESULT_SELECT_HLP(GEN_PREFIX, GEN_HAS_RESULT)	\
+	COBJPVT_GEN_RESULT_SELECT_HLP2(GEN_PREFIX, GEN_HAS_RESULT)
+#define COBJPVT_GEN_RESULT_SELECT_HLP2(GEN_PREFIX, GEN_HAS_RESULT)	\
+	GEN_PREFIX ## _ ## GEN_HAS_RESULT
+
+//	in the profiling build, each method of the interface-registry records the class it's called on
+#ifdef COBJ_PROFILE_GENERATE
+#	include "cobj-profile.h"
+#	define COBJPVT_GEN_PROFILE_RECORD(GEN_METHODNAME)	\
+		static cobj_profile_site site = { .interface_name = COBJPVT_PP_STRINGIFY(COBJ_INTERFACE_NAME), .method_name = #GEN_METHODNAME };	\
+		cobj_profile_record(&site, reference->object);
+#else
+#	define COBJPVT_GEN_PROFILE_RECORD(GEN_METHODNAME)
+#endif
+
+//	in the tracing build, the thunks of the classes have a probe at the entry and the return of each method (see cobj-usdt.h)
+#ifdef COBJ_USDT
+#	include "cobj-usdt.h"
+#	define COBJPVT_GEN_USDT_PROBE(GEN_PROBE, GEN_METHODNAME)	\
+		COBJ_USDT_PROBE4(cobj, GEN_PROBE, COBJPVT_PP_STRINGIFY(COBJ_CLASS_NAME), COBJPVT_PP_STRINGIFY(COBJ_INTERFACE_NAME), #GEN_METHODNAME, self);
+#else
+#	define COBJPVT_GEN_USDT_PROBE(GEN_PROBE, GEN_METHODNAME)
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 //	Variables-Generation
 //	This macros defines the naming of the variables
 #define COBJ_CLASS_VARIABLE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
 	COBJPVT_GEN_CLASS_VARIABLE(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)
 
+/*! \brief Defines a variable, which is rarely used
+ *
+ *  Cold variables are not part of the object, but of the NAME_cold struct.
+ *  The object links to it by the "cold" variable, and the memory is passed to
+ *  the initializer. So the hot variables are using less cache-lines.
+ *
+ *  Templates expanding COBJ_CLASS_VARIABLES need to define
+ *  COBJPVT_GEN_CLASS_VARIABLE_COLD_TEMPLATE too.
+ */
+#define COBJ_CLASS_VARIABLE_COLD(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)	\
+	COBJPVT_GEN_CLASS_VARIABLE_COLD(GEN_VARIABLE_TYPE, GEN_VARIABLE_NAME)
+
 #define COBJPVT_GEN_CLASS_VARIABLE_GENERATOR()	\
 	COBJ_CLASS_VARIABLES
 
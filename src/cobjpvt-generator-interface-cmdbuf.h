@@ -0,0 +1,213 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+//////////////////////////////////////////////////////////////////////////
+// Generate the command buffer class of the interface (see cobj-cmdbuf.h).
+//	Included by cobj-interface-generator.h in COBJ_INTERFACE_CMDBUF_MODE, no include guard.
+//	The methods of the base interface (COBJ_INTERFACE_EXTENDS) are generated again, with
+//	the names of this interface.
+
+#define COBJPVT_GEN_DECORATOR	cmdbuf
+
+#define COBJPVT_GEN_CMDBUF_STRUCT(GEN_METHODNAME)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _command)
+
+// the result of all methods
+#define COBJPVT_GEN_CMDBUF_RESULT_0(GEN_RETURN_TYPE)
+#define COBJPVT_GEN_CMDBUF_RESULT_1(GEN_RETURN_TYPE)	\
+	GEN_RETURN_TYPE result = COBJPVT_ZERO_INITIALIZER;	\
+	return result;
+
+//////////////////////////////////////////////////////////////////////////
+// (1) the commands, holding the arguments. Pure methods have no commands.
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	typedef struct {	\
+		cobj_cmdbuf_header command_header;	\
+		GEN_ARGS_MEMBERS	\
+	} COBJPVT_GEN_CMDBUF_STRUCT(GEN_METHODNAME);	\
+	COBJPVT_ASSERT(_Alignof(COBJPVT_GEN_CMDBUF_STRUCT(GEN_METHODNAME)) <= COBJ_CMDBUF_ALIGNMENT, "the arguments of " #GEN_METHODNAME " need a larger COBJ_CMDBUF_ALIGNMENT");
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+
+	COBJPVT_GEN_ALL_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+
+//////////////////////////////////////////////////////////////////////////
+// (2) the thunks of the cmdbuf: they append the command, a setter replaces the last command if it's the same method.
+//	A full buffer drops the command, and is not executed.
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	static GEN_RETURN_TYPE COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		geninterface_cmdbuf * cmdbuf = (geninterface_cmdbuf *)self;	\
+		COBJPVT_GEN_CMDBUF_STRUCT(GEN_METHODNAME) * frame = (COBJPVT_GEN_CMDBUF_STRUCT(GEN_METHODNAME) *)cobj_cmdbuf_append(&cmdbuf->private_data.buffer, COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME), sizeof(*frame));	\
+		if(frame){	\
+			GEN_ARGS_STORE	\
+		}	\
+		COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_CMDBUF_RESULT)(GEN_RETURN_TYPE)	\
+	}
+
+#undef COBJPVT_GEN_SETTER_METHOD_TEMPLATE
+#define COBJPVT_GEN_SETTER_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	static GEN_RETURN_TYPE COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		geninterface_cmdbuf * cmdbuf = (geninterface_cmdbuf *)self;	\
+		COBJPVT_GEN_CMDBUF_STRUCT(GEN_METHODNAME) * frame = (COBJPVT_GEN_CMDBUF_STRUCT(GEN_METHODNAME) *)cobj_cmdbuf_last(&cmdbuf->private_data.buffer, COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME));	\
+		if(!frame){	\
+			frame = (COBJPVT_GEN_CMDBUF_STRUCT(GEN_METHODNAME) *)cobj_cmdbuf_append(&cmdbuf->private_data.buffer, COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME), sizeof(*frame));	\
+		}	\
+		if(frame){	\
+			GEN_ARGS_STORE	\
+		}	\
+		COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_CMDBUF_RESULT)(GEN_RETURN_TYPE)	\
+	}
+
+// the arguments of pure methods are stored into a local, so they are not unused
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	static GEN_RETURN_TYPE COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		struct { char none; GEN_ARGS_MEMBERS } arguments, * frame = &arguments;	\
+		GEN_ARGS_STORE	\
+		(void)self;	\
+		(void)frame;	\
+		COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_CMDBUF_RESULT)(GEN_RETURN_TYPE)	\
+	}
+
+#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+
+	COBJPVT_GEN_ALL_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#undef COBJPVT_GEN_SETTER_METHOD_TEMPLATE
+#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE		COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#define COBJPVT_GEN_SETTER_METHOD_TEMPLATE		COBJPVT_GEN_MUTATING_METHOD_TEMPLATE
+
+//////////////////////////////////////////////////////////////////////////
+// (3) the class of the cmdbuf
+#define COBJPVT_GEN_METHOD_TEMPLATE	COBJPVT_GEN_DECORATOR_MT_TEMPLATE
+	COBJPVT_GEN_DECORATOR_CLASS(geninterface_cmdbuf)
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+
+// the memory needs to be aligned to COBJ_CMDBUF_ALIGNMENT
+bool geninterface_cmdbuf_initialize(geninterface_cmdbuf * self, void * memory, size_t capacity)
+{
+	self->private_data.class_desriptor = &COBJPVT_GEN_DECORATOR_DESCRIPTOR;
+	
+	return cobj_cmdbuf_initialize(&self->private_data.buffer, memory, capacity);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// (4) the execution: the commands are called through the mt of the target, loaded once. The results are dropped.
+//	The method ids are checked before, so a buffer with a command of another interface executes nothing.
+static bool COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, COBJPVT_GEN_DECORATOR, _validate)(const cobj_cmdbuf * buffer)
+{
+	for(const cobj_cmdbuf_header * header = cobj_cmdbuf_first(buffer); header; header = cobj_cmdbuf_next(buffer, header)){
+		switch(header->method){
+		
+		#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+		#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+		#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+			case COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME):
+		#define COBJPVT_GEN_PURE_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+		#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+		
+			COBJPVT_GEN_ALL_METHOD_GENERATOR()
+				break;
+		
+		#undef COBJPVT_GEN_METHOD_TEMPLATE
+		#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+		#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+		
+		default:
+			// not a command of this interface
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+bool geninterface_cmdbuf_execute(const geninterface_cmdbuf * self, const geninterface_reference * target)
+{
+	const cobj_cmdbuf * buffer = &self->private_data.buffer;
+	const geninterface_mt * mt = target->mt;
+	cobj_object * object = target->object;
+	
+	if(buffer->overflow || !COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, COBJPVT_GEN_DECORATOR, _validate)(buffer)){
+		return false;
+	}
+	
+	for(const cobj_cmdbuf_header * header = cobj_cmdbuf_first(buffer); header; header = cobj_cmdbuf_next(buffer, header)){
+		switch(header->method){
+		
+		#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+		#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+		#define COBJPVT_GEN_CMDBUF_MEMBER(GEN_METHODNAME)	\
+			GEN_METHODNAME
+		#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+			case COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME): {	\
+				const COBJPVT_GEN_CMDBUF_STRUCT(GEN_METHODNAME) * frame = (const COBJPVT_GEN_CMDBUF_STRUCT(GEN_METHODNAME) *)header;	\
+				(void)frame;	\
+				mt->COBJPVT_GEN_CMDBUF_MEMBER(GEN_METHODNAME)(object GEN_ARGS_SEPERATOR GEN_ARGS_LOAD);	\
+				break;	\
+			}
+		#define COBJPVT_GEN_PURE_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+		#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+		
+			COBJPVT_GEN_METHOD_GENERATOR()
+			
+		#ifdef COBJ_INTERFACE_EXTENDS
+			#undef COBJPVT_GEN_CMDBUF_MEMBER
+			#define COBJPVT_GEN_CMDBUF_MEMBER(GEN_METHODNAME)	\
+				COBJ_INTERFACE_EXTENDS.GEN_METHODNAME
+			
+			COBJPVT_GEN_BASE_METHOD_GENERATOR()
+		#endif
+		
+		#undef COBJPVT_GEN_CMDBUF_MEMBER
+		#undef COBJPVT_GEN_METHOD_TEMPLATE
+		#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+		#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+		
+		default:
+			// checked by validate
+			break;
+		}
+	}
+	
+	return true;
+}
+
+// restore the default templates
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE		COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+
+#undef COBJPVT_GEN_DECORATOR
+#undef COBJPVT_GEN_CMDBUF_STRUCT
+#undef COBJPVT_GEN_CMDBUF_RESULT_0
+#undef COBJPVT_GEN_CMDBUF_RESULT_1
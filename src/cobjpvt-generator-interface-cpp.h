@@ -0,0 +1,154 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+//////////////////////////////////////////////////////////////////////////
+// Generates the C++ layer of the interface COBJ_INTERFACE_NAME (see cobj.hpp)
+//
+//	This is included by the interface generator, if the interface is included by C++20 code.
+//	The references have the methods of the interface as inline member functions:
+//
+//	cobj::ref<I>: calls through the method-table of the reference, like the C functions do
+//	cobj::ref<I, C>: calls through the method-table of class C, which is a constant
+//
+//	The static method-table is declared by the class header (COBJ_STATIC_REFERENCE uses it too),
+//	so the compiler knows the table of each call, and doesn't load it from the reference. It's
+//	defined in the .c file of the class, so the call is still indirect. Only link-time optimization
+//	sees the thunks in the table, and makes it a direct call with the _impl method inlined.
+//
+//	The interface is named by ::geninterface_reference inside the methods, because an argument
+//	may have the name of the interface (like set(int value) of the interface value).
+//////////////////////////////////////////////////////////////////////////
+
+#include "cobj.hpp"
+
+namespace cobj {
+	
+	//////////////////////////////////////////////////////////////////////////
+	// (1) traits
+	template<> struct interface_traits<geninterface_reference> {
+		typedef geninterface_reference reference_type;
+		typedef geninterface_mt mt_type;
+		
+		static constexpr const char * name = COBJPVT_PP_STRINGIFY(COBJ_INTERFACE_NAME);
+		
+		// including the methods of the base interface, like the descriptor
+		static constexpr std::size_t methods_count = sizeof(geninterface_mt) / sizeof(void (*)(void));
+		
+		// the address of the descriptor pointer, because the descriptor is defined by the interface-registry
+		static constexpr const cobj_interface_descriptor * const * descriptor = &geninterface_descriptor;
+	};
+	
+	//////////////////////////////////////////////////////////////////////////
+	// (2) reference to an object of any class, dynamic dispatch
+	template<> class ref<geninterface_reference> {
+	public:
+		geninterface_reference reference;
+		
+		ref() = default;
+		
+		ref(const geninterface_reference & reference)
+			: reference(reference)
+		{
+		}
+		
+		// to an object of a known class, without queryinterface
+		template<class C> requires implements<C, geninterface_reference>
+		ref(C & object)
+			: reference{ const_cast<geninterface_mt *>(implementation<C, geninterface_reference>::mt), &object.object }
+		{
+		}
+		
+		static bool query(cobj_object * object, ref & result)
+		{
+			return geninterface_queryinterface(object, &result.reference);
+		}
+		
+		operator const geninterface_reference & () const
+		{
+			return reference;
+		}
+		
+		#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+			GEN_RETURN_TYPE GEN_METHODNAME(GEN_ARGS_SIGNATURE) const {	\
+				GEN_RETURN_STATEMENT reference.mt->GEN_METHODNAME(reference.object GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
+			}
+			
+			COBJPVT_GEN_METHOD_GENERATOR()
+		#undef COBJPVT_GEN_METHOD_TEMPLATE
+		
+		#ifdef COBJ_INTERFACE_EXTENDS
+			ref<geninterface_base_reference> as_base() const
+			{
+				return geninterface_as_base(&reference);
+			}
+			
+			#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+				GEN_RETURN_TYPE GEN_METHODNAME(GEN_ARGS_SIGNATURE) const {	\
+					GEN_RETURN_STATEMENT reference.mt->COBJ_INTERFACE_EXTENDS.GEN_METHODNAME(reference.object GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
+				}
+				
+				COBJPVT_GEN_BASE_METHOD_GENERATOR()
+			#undef COBJPVT_GEN_METHOD_TEMPLATE
+		#endif
+	};
+	
+	//////////////////////////////////////////////////////////////////////////
+	// (3) reference to an object of class C, static dispatch (indirect without link-time optimization)
+	template<class C> requires implements<C, geninterface_reference>
+	class ref<geninterface_reference, C> {
+	public:
+		C * object;
+		
+		explicit ref(C & object)
+			: object(&object)
+		{
+		}
+		
+		// the dynamic reference to the same object
+		operator ref<geninterface_reference>() const
+		{
+			return ref<geninterface_reference>(*object);
+		}
+		
+		#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+			GEN_RETURN_TYPE GEN_METHODNAME(GEN_ARGS_SIGNATURE) const {	\
+				GEN_RETURN_STATEMENT implementation<C, ::geninterface_reference>::mt->GEN_METHODNAME(&object->object GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
+			}
+			
+			COBJPVT_GEN_METHOD_GENERATOR()
+		#undef COBJPVT_GEN_METHOD_TEMPLATE
+		
+		#ifdef COBJ_INTERFACE_EXTENDS
+			#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)	\
+				GEN_RETURN_TYPE GEN_METHODNAME(GEN_ARGS_SIGNATURE) const {	\
+					GEN_RETURN_STATEMENT implementation<C, ::geninterface_reference>::mt->COBJ_INTERFACE_EXTENDS.GEN_METHODNAME(&object->object GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
+				}
+				
+				COBJPVT_GEN_BASE_METHOD_GENERATOR()
+			#undef COBJPVT_GEN_METHOD_TEMPLATE
+		#endif
+	};
+}
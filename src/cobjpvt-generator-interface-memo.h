@@ -0,0 +1,195 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+//////////////////////////////////////////////////////////////////////////
+// Generate the memo class of the interface (see COBJ_INTERFACE_PURE_METHOD).
+//	Included by cobj-interface-generator.h in COBJ_INTERFACE_MEMO_MODE, no include guard.
+//	The methods of the base interface (COBJ_INTERFACE_EXTENDS) are generated again, with
+//	the names of this interface.
+//
+//	The memo forwards all calls to the target:
+//		* pure methods return the cached result, if they were called with the same arguments before.
+//		  Each argument is compared by it's bytes: pointers by the address (the identity of the object
+//		  pointed to, not it's content), floats by their bits.
+//		* mutating methods (and setters) invalidate all cached results, by incrementing the generation
+//		* other methods are just forwarded
+//	It's not synchronized, so it's used by a single thread (like the reference it's replacing).
+
+#include <string.h>
+
+#define COBJPVT_GEN_DECORATOR	memo
+
+// compares the members of the key with the key of the entry, without the padding between them.
+//	The members are the list GEN_ARGS_LOAD (like "frame->a, frame->b"), their offset in the key is the same in the entry.
+#define COBJPVT_GEN_MEMO_EQUAL(...)	\
+	COBJ_PP_CONCAT(COBJPVT_GEN_MEMO_EQUAL_, COBJPVT_PP_NARG(__VA_ARGS__))(__VA_ARGS__)
+#define COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_MEMBER)	\
+	&& memcmp(&(GEN_MEMBER), (const char *)&memo_cache->entries[memo_slot].key + ((const char *)&(GEN_MEMBER) - (const char *)frame), sizeof(GEN_MEMBER)) == 0
+
+#define COBJPVT_GEN_MEMO_EQUAL_0()
+#define COBJPVT_GEN_MEMO_EQUAL_1(GEN_M00)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00)
+#define COBJPVT_GEN_MEMO_EQUAL_2(GEN_M00, GEN_M01)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01)
+#define COBJPVT_GEN_MEMO_EQUAL_3(GEN_M00, GEN_M01, GEN_M02)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02)
+#define COBJPVT_GEN_MEMO_EQUAL_4(GEN_M00, GEN_M01, GEN_M02, GEN_M03)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03)
+#define COBJPVT_GEN_MEMO_EQUAL_5(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04)
+#define COBJPVT_GEN_MEMO_EQUAL_6(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04, GEN_M05)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M05)
+#define COBJPVT_GEN_MEMO_EQUAL_7(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04, GEN_M05, GEN_M06)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M05) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M06)
+#define COBJPVT_GEN_MEMO_EQUAL_8(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04, GEN_M05, GEN_M06, GEN_M07)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M05) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M06) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M07)
+#define COBJPVT_GEN_MEMO_EQUAL_9(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04, GEN_M05, GEN_M06, GEN_M07, GEN_M08)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M05) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M06) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M07) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M08)
+#define COBJPVT_GEN_MEMO_EQUAL_10(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04, GEN_M05, GEN_M06, GEN_M07, GEN_M08, GEN_M09)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M05) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M06) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M07) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M08) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M09)
+#define COBJPVT_GEN_MEMO_EQUAL_11(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04, GEN_M05, GEN_M06, GEN_M07, GEN_M08, GEN_M09, GEN_M10)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M05) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M06) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M07) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M08) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M09) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M10)
+#define COBJPVT_GEN_MEMO_EQUAL_12(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04, GEN_M05, GEN_M06, GEN_M07, GEN_M08, GEN_M09, GEN_M10, GEN_M11)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M05) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M06) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M07) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M08) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M09) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M10) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M11)
+#define COBJPVT_GEN_MEMO_EQUAL_13(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04, GEN_M05, GEN_M06, GEN_M07, GEN_M08, GEN_M09, GEN_M10, GEN_M11, GEN_M12)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M05) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M06) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M07) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M08) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M09) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M10) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M11) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M12)
+#define COBJPVT_GEN_MEMO_EQUAL_14(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04, GEN_M05, GEN_M06, GEN_M07, GEN_M08, GEN_M09, GEN_M10, GEN_M11, GEN_M12, GEN_M13)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M05) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M06) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M07) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M08) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M09) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M10) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M11) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M12) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M13)
+#define COBJPVT_GEN_MEMO_EQUAL_15(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04, GEN_M05, GEN_M06, GEN_M07, GEN_M08, GEN_M09, GEN_M10, GEN_M11, GEN_M12, GEN_M13, GEN_M14)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M05) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M06) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M07) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M08) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M09) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M10) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M11) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M12) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M13) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M14)
+#define COBJPVT_GEN_MEMO_EQUAL_16(GEN_M00, GEN_M01, GEN_M02, GEN_M03, GEN_M04, GEN_M05, GEN_M06, GEN_M07, GEN_M08, GEN_M09, GEN_M10, GEN_M11, GEN_M12, GEN_M13, GEN_M14, GEN_M15)	\
+	COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M00) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M01) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M02) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M03) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M04) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M05) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M06) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M07) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M08) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M09) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M10) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M11) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M12) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M13) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M14) COBJPVT_GEN_MEMO_MEMBER_EQUAL(GEN_M15)
+
+//////////////////////////////////////////////////////////////////////////
+// (1) the thunks of the memo
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	static GEN_RETURN_TYPE COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		geninterface_memo * memo = (geninterface_memo *)self;	\
+		GEN_RETURN_STATEMENT COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(&memo->private_data.target GEN_ARGS_SEPERATOR GEN_ARGS_NAME);	\
+	}
+
+// the generation is incremented after the call, so results of pure methods called meanwhile are not cached
+#undef COBJPVT_GEN_MUTATING_METHOD_TEMPLATE
+#define COBJPVT_GEN_MUTATING_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	static GEN_RETURN_TYPE COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		geninterface_memo * memo = (geninterface_memo *)self;	\
+		COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_MEMO_MUTATE)(GEN_RETURN_TYPE, GEN_METHODNAME, (GEN_ARGS_SEPERATOR GEN_ARGS_NAME))	\
+	}
+
+#define COBJPVT_GEN_MEMO_MUTATE_0(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_SEPERATED_ARGS_NAME)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(&memo->private_data.target COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_NAME));	\
+	memo->private_data.generation++;
+#define COBJPVT_GEN_MEMO_MUTATE_1(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_SEPERATED_ARGS_NAME)	\
+	GEN_RETURN_TYPE result = COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(&memo->private_data.target COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_NAME));	\
+	memo->private_data.generation++;	\
+	return result;
+
+// pure methods without result have nothing to cache, they are just forwarded
+#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	static GEN_RETURN_TYPE COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		geninterface_memo * memo = (geninterface_memo *)self;	\
+		COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_MEMO_LOOKUP)(GEN_RETURN_TYPE, GEN_METHODNAME, (GEN_ARGS_SEPERATOR GEN_ARGS_NAME), GEN_ARGS_STORE, (GEN_ARGS_LOAD))	\
+	}
+
+#define COBJPVT_GEN_MEMO_LOOKUP_0(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_SEPERATED_ARGS_NAME, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(&memo->private_data.target COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_NAME));
+#define COBJPVT_GEN_MEMO_LOOKUP_1(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_SEPERATED_ARGS_NAME, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	COBJPVT_GEN_MEMO_CACHE(GEN_METHODNAME) * memo_cache = &memo->private_data.COBJ_PP_CONCAT(GEN_METHODNAME, _cache);	\
+	uint64_t memo_generation = memo->private_data.generation;	\
+	COBJPVT_GEN_MEMO_KEY(GEN_METHODNAME) memo_key = { 0 };	\
+	COBJPVT_GEN_MEMO_KEY(GEN_METHODNAME) * frame = &memo_key;	\
+	(void)frame;	\
+	GEN_ARGS_STORE	\
+	for(size_t memo_slot = 0; memo_slot < sizeof(memo_cache->entries) / sizeof(memo_cache->entries[0]); memo_slot++){	\
+		if(memo_cache->entries[memo_slot].generation == memo_generation COBJPVT_GEN_MEMO_EQUAL(COBJPVT_PP_REMOVE_PARENS(GEN_ARGS_LOAD))){	\
+			return memo_cache->entries[memo_slot].result;	\
+		}	\
+	}	\
+	GEN_RETURN_TYPE result = COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(&memo->private_data.target COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_NAME));	\
+	COBJPVT_GEN_MEMO_ENTRY(GEN_METHODNAME) * memo_entry = &memo_cache->entries[memo_cache->next];	\
+	memo_cache->next = (memo_cache->next + 1) % (sizeof(memo_cache->entries) / sizeof(memo_cache->entries[0]));	\
+	memo_entry->generation = memo_generation;	\
+	memo_entry->key = memo_key;	\
+	memo_entry->result = result;	\
+	return result;
+
+#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+
+	COBJPVT_GEN_ALL_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+
+// restore the default templates
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+#undef COBJPVT_GEN_MUTATING_METHOD_TEMPLATE
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE		COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#define COBJPVT_GEN_MUTATING_METHOD_TEMPLATE	COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+
+//////////////////////////////////////////////////////////////////////////
+// (2) the class of the memo
+#define COBJPVT_GEN_METHOD_TEMPLATE	COBJPVT_GEN_DECORATOR_MT_TEMPLATE
+	COBJPVT_GEN_DECORATOR_CLASS(geninterface_memo)
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+
+// the entries have generation 0, so they are invalid
+bool geninterface_memo_initialize(geninterface_memo * self, const geninterface_reference * target)
+{
+	memset(self, 0, sizeof(*self));
+	
+	self->private_data.class_desriptor = &COBJPVT_GEN_DECORATOR_DESCRIPTOR;
+	self->private_data.target = *target;
+	self->private_data.generation = 1;
+	
+	return true;
+}
+
+#undef COBJPVT_GEN_DECORATOR
+#undef COBJPVT_GEN_MEMO_MUTATE_0
+#undef COBJPVT_GEN_MEMO_MUTATE_1
+#undef COBJPVT_GEN_MEMO_LOOKUP_0
+#undef COBJPVT_GEN_MEMO_LOOKUP_1
+#undef COBJPVT_GEN_MEMO_EQUAL
+#undef COBJPVT_GEN_MEMO_MEMBER_EQUAL
+#undef COBJPVT_GEN_MEMO_EQUAL_0
+#undef COBJPVT_GEN_MEMO_EQUAL_1
+#undef COBJPVT_GEN_MEMO_EQUAL_2
+#undef COBJPVT_GEN_MEMO_EQUAL_3
+#undef COBJPVT_GEN_MEMO_EQUAL_4
+#undef COBJPVT_GEN_MEMO_EQUAL_5
+#undef COBJPVT_GEN_MEMO_EQUAL_6
+#undef COBJPVT_GEN_MEMO_EQUAL_7
+#undef COBJPVT_GEN_MEMO_EQUAL_8
+#undef COBJPVT_GEN_MEMO_EQUAL_9
+#undef COBJPVT_GEN_MEMO_EQUAL_10
+#undef COBJPVT_GEN_MEMO_EQUAL_11
+#undef COBJPVT_GEN_MEMO_EQUAL_12
+#undef COBJPVT_GEN_MEMO_EQUAL_13
+#undef COBJPVT_GEN_MEMO_EQUAL_14
+#undef COBJPVT_GEN_MEMO_EQUAL_15
+#undef COBJPVT_GEN_MEMO_EQUAL_16
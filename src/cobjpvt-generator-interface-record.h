@@ -0,0 +1,143 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+//////////////////////////////////////////////////////////////////////////
+// Generate the recorder class and the replay of the interface (see cobj-record.h).
+//	Included by cobj-interface-generator.h in COBJ_INTERFACE_RECORD_MODE, no include guard.
+//	The methods of the base interface (COBJ_INTERFACE_EXTENDS) are generated again, with
+//	the names of this interface.
+
+#include <string.h>
+
+#include "cobj-record.h"
+
+#define COBJPVT_GEN_DECORATOR	recorder
+
+#define COBJPVT_GEN_RECORD_STRUCT(GEN_METHODNAME)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _record)
+
+//////////////////////////////////////////////////////////////////////////
+// (1) the records, holding the arguments
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	typedef struct {	\
+		cobj_record_header record_header;	\
+		GEN_ARGS_MEMBERS	\
+	} COBJPVT_GEN_RECORD_STRUCT(GEN_METHODNAME);	\
+	COBJPVT_ASSERT(sizeof(COBJPVT_GEN_RECORD_STRUCT(GEN_METHODNAME)) <= COBJ_RECORD_MAX_SIZE, "the arguments of " #GEN_METHODNAME " don't fit into COBJ_RECORD_MAX_SIZE");
+#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+
+	COBJPVT_GEN_ALL_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+
+//////////////////////////////////////////////////////////////////////////
+// (2) the thunks of the recorder: they forward the call to the target, and write the record
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	static GEN_RETURN_TYPE COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		geninterface_recorder * recorder = (geninterface_recorder *)self;	\
+		COBJPVT_GEN_RECORD_STRUCT(GEN_METHODNAME) record;	\
+		COBJPVT_GEN_RECORD_STRUCT(GEN_METHODNAME) * frame = &record;	\
+		memset(&record, 0, sizeof(record));	/* the padding is written to the file too */	\
+		(void)frame;	\
+		GEN_ARGS_STORE	\
+		uint64_t start = cobj_record_now();	\
+		COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_RECORD_CALL)(GEN_RETURN_TYPE, GEN_METHODNAME, (GEN_ARGS_SEPERATOR GEN_ARGS_NAME))	\
+	}
+
+#define COBJPVT_GEN_RECORD_CALL_0(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_SEPERATED_ARGS_NAME)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(&recorder->private_data.target COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_NAME));	\
+	cobj_record_write(recorder->private_data.writer, &record.record_header, COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME), sizeof(record), start);
+#define COBJPVT_GEN_RECORD_CALL_1(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_SEPERATED_ARGS_NAME)	\
+	GEN_RETURN_TYPE result = COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(&recorder->private_data.target COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_NAME));	\
+	cobj_record_write(recorder->private_data.writer, &record.record_header, COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME), sizeof(record), start);	\
+	return result;
+
+	COBJPVT_GEN_ALL_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+
+//////////////////////////////////////////////////////////////////////////
+// (3) the class of the recorder
+#define COBJPVT_GEN_METHOD_TEMPLATE	COBJPVT_GEN_DECORATOR_MT_TEMPLATE
+	COBJPVT_GEN_DECORATOR_CLASS(geninterface_recorder)
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+
+bool geninterface_recorder_initialize(geninterface_recorder * self, const geninterface_reference * target, cobj_record_writer * writer)
+{
+	self->private_data.class_desriptor = &COBJPVT_GEN_DECORATOR_DESCRIPTOR;
+	self->private_data.target = *target;
+	self->private_data.writer = writer;
+	
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// (4) the replay: calls the method of the record on the target. The result is dropped.
+bool geninterface_replay_dispatch(const void * target, const cobj_record_header * record)
+{
+	const geninterface_reference * reference = (const geninterface_reference *)target;
+	
+	switch(record->method){
+	
+	#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+	#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+		case COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME): {	\
+			const COBJPVT_GEN_RECORD_STRUCT(GEN_METHODNAME) * frame = (const COBJPVT_GEN_RECORD_STRUCT(GEN_METHODNAME) *)record;	\
+			if(record->size != sizeof(*frame)){	\
+				return false;	\
+			}	\
+			COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(reference GEN_ARGS_SEPERATOR GEN_ARGS_LOAD);	\
+			return true;	\
+		}
+	
+	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+	
+		COBJPVT_GEN_ALL_METHOD_GENERATOR()
+	
+	#undef COBJPVT_GEN_METHOD_TEMPLATE
+	#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+	
+	}
+	
+	// recorded with another version of the interface
+	return false;
+}
+
+bool geninterface_replay(const char * path, const geninterface_reference * target, bool paced, cobj_record_stats * stats)
+{
+	return cobj_record_replay(path, COBJPVT_PP_STRINGIFY(COBJ_INTERFACE_NAME), &geninterface_replay_dispatch, target, paced, stats);
+}
+
+// restore the default templates
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+
+#undef COBJPVT_GEN_DECORATOR
+#undef COBJPVT_GEN_RECORD_STRUCT
+#undef COBJPVT_GEN_RECORD_CALL_0
+#undef COBJPVT_GEN_RECORD_CALL_1
@@ -0,0 +1,172 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+//////////////////////////////////////////////////////////////////////////
+// Generate the proxy class and the stub of the interface (see cobj-remote.h).
+//	Included by cobj-interface-generator.h in COBJ_INTERFACE_REMOTE_MODE, no include guard.
+//	The methods of the base interface (COBJ_INTERFACE_EXTENDS) are generated again, with
+//	the names of this interface.
+
+#include "cobj-remote.h"
+
+#define COBJPVT_GEN_DECORATOR	proxy
+
+#define COBJPVT_GEN_REMOTE_REQUEST(GEN_METHODNAME)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _request)
+#define COBJPVT_GEN_REMOTE_REPLY(GEN_METHODNAME)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME, _reply)
+
+//////////////////////////////////////////////////////////////////////////
+// (1) the messages: the request holds the arguments, the reply the result
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	typedef struct {	\
+		cobj_remote_header remote_header;	\
+		GEN_ARGS_MEMBERS	\
+	} COBJPVT_GEN_REMOTE_REQUEST(GEN_METHODNAME);	\
+	typedef struct {	\
+		cobj_remote_header remote_header;	\
+		COBJPVT_GEN_ASYNC_RESULT(GEN_RETURN_TYPE)	\
+	} COBJPVT_GEN_REMOTE_REPLY(GEN_METHODNAME);	\
+	COBJPVT_ASSERT(sizeof(COBJPVT_GEN_REMOTE_REQUEST(GEN_METHODNAME)) <= COBJ_REMOTE_RING_SIZE / 2, "the arguments of " #GEN_METHODNAME " don't fit into COBJ_REMOTE_RING_SIZE");
+#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+
+	COBJPVT_GEN_ALL_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+
+//////////////////////////////////////////////////////////////////////////
+// (2) the thunks of the proxy: they write the request, and wait for the reply if there is a result.
+//	Methods returning void are pipelined, the next call is written while the stub executes them.
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	static GEN_RETURN_TYPE COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		cobj_remote_channel * channel = ((geninterface_proxy *)self)->private_data.channel;	\
+		COBJPVT_GEN_REMOTE_REQUEST(GEN_METHODNAME) * frame = (COBJPVT_GEN_REMOTE_REQUEST(GEN_METHODNAME) *)cobj_remote_request(	\
+			channel, COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME), sizeof(COBJPVT_GEN_REMOTE_REQUEST(GEN_METHODNAME)));	\
+		if(!frame) {	\
+			COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_REMOTE_FAILED)(GEN_RETURN_TYPE)	\
+		}	\
+		GEN_ARGS_STORE	\
+		COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_REMOTE_CALL)(GEN_RETURN_TYPE, GEN_METHODNAME)	\
+	}
+
+// if the channel failed, the result is zero
+#define COBJPVT_GEN_REMOTE_FAILED_0(GEN_RETURN_TYPE)	\
+	return;
+#define COBJPVT_GEN_REMOTE_FAILED_1(GEN_RETURN_TYPE)	\
+	static GEN_RETURN_TYPE failed_result;	\
+	return failed_result;
+
+#define COBJPVT_GEN_REMOTE_CALL_0(GEN_RETURN_TYPE, GEN_METHODNAME)	\
+	cobj_remote_ring_commit(&channel->requests);
+#define COBJPVT_GEN_REMOTE_CALL_1(GEN_RETURN_TYPE, GEN_METHODNAME)	\
+	const COBJPVT_GEN_REMOTE_REPLY(GEN_METHODNAME) * reply = (const COBJPVT_GEN_REMOTE_REPLY(GEN_METHODNAME) *)cobj_remote_call(channel, COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME));	\
+	if(!reply) {	\
+		COBJPVT_GEN_REMOTE_FAILED_1(GEN_RETURN_TYPE)	\
+	}	\
+	GEN_RETURN_TYPE result = reply->result;	\
+	cobj_remote_ring_release(&channel->replies, &reply->remote_header);	\
+	return result;
+
+	COBJPVT_GEN_ALL_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+
+//////////////////////////////////////////////////////////////////////////
+// (3) the class of the proxy
+#define COBJPVT_GEN_METHOD_TEMPLATE	COBJPVT_GEN_DECORATOR_MT_TEMPLATE
+	COBJPVT_GEN_DECORATOR_CLASS(geninterface_proxy)
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+
+bool geninterface_proxy_initialize(geninterface_proxy * self, cobj_remote_channel * channel)
+{
+	self->private_data.class_desriptor = &COBJPVT_GEN_DECORATOR_DESCRIPTOR;
+	self->private_data.channel = channel;
+	
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// (4) the stub: calls the method of the request on the target, and writes the reply if there is a result
+bool geninterface_stub_dispatch(const void * target, const cobj_remote_header * request, cobj_remote_channel * channel)
+{
+	const geninterface_reference * reference = (const geninterface_reference *)target;
+	
+	(void)channel;
+	
+	switch(request->method){
+	
+	#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+	#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+		case COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME): {	\
+			const COBJPVT_GEN_REMOTE_REQUEST(GEN_METHODNAME) * frame = (const COBJPVT_GEN_REMOTE_REQUEST(GEN_METHODNAME) *)request;	\
+			(void)frame;	\
+			COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_REMOTE_DISPATCH)(GEN_RETURN_TYPE, GEN_METHODNAME, (GEN_ARGS_SEPERATOR GEN_ARGS_LOAD))	\
+			return true;	\
+		}
+	
+	#define COBJPVT_GEN_REMOTE_DISPATCH_0(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_SEPERATED_ARGS_LOAD)	\
+		COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(reference COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_LOAD));
+	#define COBJPVT_GEN_REMOTE_DISPATCH_1(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_SEPERATED_ARGS_LOAD)	\
+		GEN_RETURN_TYPE result = COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(reference COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_LOAD));	\
+		COBJPVT_GEN_REMOTE_REPLY(GEN_METHODNAME) * reply = (COBJPVT_GEN_REMOTE_REPLY(GEN_METHODNAME) *)cobj_remote_reply(	\
+			channel, COBJPVT_GEN_DECORATOR_METHOD_ID(GEN_METHODNAME), sizeof(COBJPVT_GEN_REMOTE_REPLY(GEN_METHODNAME)));	\
+		if(reply) {	\
+			reply->result = result;	\
+			cobj_remote_ring_commit(&channel->replies);	\
+		}
+	
+	#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+	
+		COBJPVT_GEN_ALL_METHOD_GENERATOR()
+	
+	#undef COBJPVT_GEN_METHOD_TEMPLATE
+	#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+	
+	}
+	
+	return false;
+}
+
+void geninterface_stub_serve(cobj_remote_channel * channel, const geninterface_reference * target)
+{
+	cobj_remote_serve(channel, &geninterface_stub_dispatch, target);
+}
+
+// restore the default templates
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+
+#undef COBJPVT_GEN_DECORATOR
+#undef COBJPVT_GEN_REMOTE_REQUEST
+#undef COBJPVT_GEN_REMOTE_REPLY
+#undef COBJPVT_GEN_REMOTE_FAILED_0
+#undef COBJPVT_GEN_REMOTE_FAILED_1
+#undef COBJPVT_GEN_REMOTE_CALL_0
+#undef COBJPVT_GEN_REMOTE_CALL_1
+#undef COBJPVT_GEN_REMOTE_DISPATCH_0
+#undef COBJPVT_GEN_REMOTE_DISPATCH_1
@@ -0,0 +1,90 @@
+/*
+
+MIT License
+
+Copyright (c) 2016 Guenter Prossliner
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+//////////////////////////////////////////////////////////////////////////
+// Generate the synchronized decorator of the interface (see cobj-synchronized.h).
+//	Included by cobj-interface-generator.h in COBJ_INTERFACE_SYNCHRONIZED_MODE, no include guard.
+//	The methods of the base interface (COBJ_INTERFACE_EXTENDS) are generated again, with
+//	the names of this interface.
+
+#include "cobj-synchronized.h"
+
+#define COBJPVT_GEN_DECORATOR	synchronized
+
+#define COBJPVT_GEN_SYNCHRONIZED_CALL_0(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_SEPERATED_ARGS_NAME, GEN_UNLOCK)	\
+	COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(&synchronized->private_data.target COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_NAME));	\
+	GEN_UNLOCK(synchronized->private_data.lock);
+#define COBJPVT_GEN_SYNCHRONIZED_CALL_1(GEN_RETURN_TYPE, GEN_METHODNAME, GEN_SEPERATED_ARGS_NAME, GEN_UNLOCK)	\
+	GEN_RETURN_TYPE result = COBJ_PP_CONCAT(COBJ_INTERFACE_NAME, _, GEN_METHODNAME)(&synchronized->private_data.target COBJPVT_PP_REMOVE_PARENS(GEN_SEPERATED_ARGS_NAME));	\
+	GEN_UNLOCK(synchronized->private_data.lock);	\
+	return result;
+
+//////////////////////////////////////////////////////////////////////////
+// (1) the thunks: pure methods share the lock, all other methods hold it exclusively
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	static GEN_RETURN_TYPE COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		geninterface_synchronized * synchronized = (geninterface_synchronized *)self;	\
+		cobj_rwlock_write_lock(synchronized->private_data.lock);	\
+		COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_SYNCHRONIZED_CALL)(GEN_RETURN_TYPE, GEN_METHODNAME, (GEN_ARGS_SEPERATOR GEN_ARGS_NAME), cobj_rwlock_write_unlock)	\
+	}
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)	\
+	static GEN_RETURN_TYPE COBJPVT_GEN_DECORATOR_THUNK(GEN_METHODNAME)(cobj_object * self GEN_ARGS_SEPERATOR GEN_ARGS_SIGNATURE) {	\
+		geninterface_synchronized * synchronized = (geninterface_synchronized *)self;	\
+		cobj_rwlock_read_lock(synchronized->private_data.lock);	\
+		COBJPVT_GEN_RESULT_SELECT(GEN_RETURN_TYPE, COBJPVT_GEN_SYNCHRONIZED_CALL)(GEN_RETURN_TYPE, GEN_METHODNAME, (GEN_ARGS_SEPERATOR GEN_ARGS_NAME), cobj_rwlock_read_unlock)	\
+	}
+#define COBJPVT_GEN_METHOD_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME)
+
+	COBJPVT_GEN_ALL_METHOD_GENERATOR()
+
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+
+// restore the default templates
+#undef COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+#undef COBJPVT_GEN_PURE_METHOD_TEMPLATE
+#define COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE(GEN_RETURN_STATEMENT, GEN_RETURN_TYPE, GEN_METHODNAME,  GEN_ARGS_SEPERATOR, GEN_ARGS_SIGNATURE, GEN_ARGS_NAME, GEN_ARGS_MEMBERS, GEN_ARGS_STORE, GEN_ARGS_LOAD)
+#define COBJPVT_GEN_PURE_METHOD_TEMPLATE		COBJPVT_GEN_METHOD_CAPTURE_TEMPLATE
+
+//////////////////////////////////////////////////////////////////////////
+// (2) the class of the synchronized decorator
+#define COBJPVT_GEN_METHOD_TEMPLATE	COBJPVT_GEN_DECORATOR_MT_TEMPLATE
+	COBJPVT_GEN_DECORATOR_CLASS(geninterface_synchronized)
+#undef COBJPVT_GEN_METHOD_TEMPLATE
+
+// the lock is owned by the caller, or a stripe (see cobj_rwlock_stripe)
+bool geninterface_synchronized_initialize(geninterface_synchronized * self, const geninterface_reference * target, cobj_rwlock * lock)
+{
+	self->private_data.class_desriptor = &COBJPVT_GEN_DECORATOR_DESCRIPTOR;
+	self->private_data.target = *target;
+	self->private_data.lock = lock;
+	
+	return true;
+}
+
+#undef COBJPVT_GEN_DECORATOR
+#undef COBJPVT_GEN_SYNCHRONIZED_CALL_0
+#undef COBJPVT_GEN_SYNCHRONIZED_CALL_1
@@ -29,9 +29,31 @@ SOFTWARE.
 
 //////////////////////////////////////////////////////////////////////////
 // COBJPVT_ASSERT: provides assertions to guide the user about things going wrong
-#define COBJPVT_ASSERT(P_CONDTION, P_MESSAGE) typedef char COBJPVT_ASSERT_##MSG[(P_CONDTION)?1:-1]
+#ifdef __cplusplus
+#	define COBJPVT_ASSERT(P_CONDTION, P_MESSAGE) static_assert(P_CONDTION, P_MESSAGE)
+#else
+#	define COBJPVT_ASSERT(P_CONDTION, P_MESSAGE) _Static_assert(P_CONDTION, P_MESSAGE)
+#endif
 #define COBJPVT_ERROR(P_MESSAGE) COBJPVT_ASSERT(0, P_MESSAGE)
 
+//////////////////////////////////////////////////////////////////////////
+// COBJPVT_EXTERN_C_BEGIN / END: the generated functions have C linkage, if included by C++ code
+#ifdef __cplusplus
+#	define COBJPVT_EXTERN_C_BEGIN	extern "C" {
+#	define COBJPVT_EXTERN_C_END	}
+#else
+#	define COBJPVT_EXTERN_C_BEGIN
+#	define COBJPVT_EXTERN_C_END
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// COBJPVT_ZERO_INITIALIZER: initializes all members of a struct with zero
+#ifdef __cplusplus
+#	define COBJPVT_ZERO_INITIALIZER	{}
+#else
+#	define COBJPVT_ZERO_INITIALIZER	{ 0 }
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // COBJPVT_PP_STRINGIFY: #s with previous arg expansion
 #define COBJPVT_PP_STRINGIFYHLP(s)				#s
@@ -55,6 +77,20 @@ SOFTWARE.
 #define COBJPVT_PP_CONCATHLP_3(a,b,c)	a##b##c
 #define COBJPVT_PP_CONCATHLP_2(a,b)	a##b
 
+//////////////////////////////////////////////////////////////////////////
+// COBJPVT_PP_IS_PAREN: expands to 1 if the argument starts with a parenthesis, else to 0
+//	This is used to detect optional symbols defined as "(value)", undefined symbols expand to 0
+#define COBJPVT_PP_IS_PAREN(x)					COBJPVT_PP_IS_PAREN_CHECK(COBJPVT_PP_IS_PAREN_PROBE x)
+#define COBJPVT_PP_IS_PAREN_PROBE(...)			~, 1
+#define COBJPVT_PP_IS_PAREN_CHECK(...)			COBJPVT_PP_IS_PAREN_CHECK_N(__VA_ARGS__, 0, ~)
+#define COBJPVT_PP_IS_PAREN_CHECK_N(x, n, ...)	n
+
+//////////////////////////////////////////////////////////////////////////
+// COBJPVT_PP_REMOVE_PARENS: (a, b) => a, b
+//	Lists containing commas are passed in parenthesis to other macros, and unpacked with this
+#define COBJPVT_PP_REMOVE_PARENS(x)				COBJPVT_PP_REMOVE_PARENS_HLP x
+#define COBJPVT_PP_REMOVE_PARENS_HLP(...)		__VA_ARGS__
+
 ////////////////////////////////
 // COBJPVT_PP_NARG
 // Thanks to Mehrwolf (http://stackoverflow.com/questions/11317474/macro-to-count-number-of-arguments/11742317#11742317)
@@ -0,0 +1,45 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "buffer_console.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static bool initialize_impl(buffer_console_impl * self, char * buffer, size_t size)
+{
+	if(!buffer || !size){
+		return false;
+	}
+	
+	self->buffer = buffer;
+	self->size = size;
+	self->length = 0;
+	self->buffer[0] = 0;
+	return true;
+}
+
+// the text is truncated to the size of the buffer
+static size_t writer_write_impl(buffer_console_impl * self, const char * buffer, size_t length)
+{
+	size_t available = self->size - 1 - self->length;
+	
+	if(length > available){
+		length = available;
+	}
+	
+	memcpy(self->buffer + self->length, buffer, length);
+	self->length += length;
+	self->buffer[self->length] = 0;
+	return length;
+}
+
+static int console_vprintf_impl(buffer_console_impl * self, const char * format, va_list vlist)
+{
+	size_t available = self->size - 1 - self->length;
+	int length = vsnprintf(self->buffer + self->length, available + 1, format, vlist);
+	
+	if(length > 0){
+		self->length += (size_t)length < available ? (size_t)length : available;
+	}
+	return length;
+}
@@ -0,0 +1,27 @@
+#ifndef BUFFER_CONSOLE_H_
+#define BUFFER_CONSOLE_H_
+
+// a console writing into a buffer of the test, so the output can be checked. It implements
+// the base writer by console (COBJ_INTERFACE_EXTENDS), and lists console only.
+
+#define COBJ_CLASS_NAME	buffer_console
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(char *, buffer)	\
+	COBJ_CLASS_PARAMETER(size_t, size)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(char *, buffer)	\
+	COBJ_CLASS_VARIABLE(size_t, size)	\
+	COBJ_CLASS_VARIABLE(size_t, length)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(console)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "interfaces/console.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+#endif /* BUFFER_CONSOLE_H_ */
@@ -0,0 +1,37 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "check_stage.h"
+
+static bool initialize_impl(check_stage_impl * self, unsigned char increment, check_stage_result * result)
+{
+	if(!result){
+		return false;
+	}
+	
+	self->increment = increment;
+	self->result = result;
+	return true;
+}
+
+static pipeline_stage_status pipeline_stage_process_impl(check_stage_impl * self, const byte_source * input, const byte_sink * output)
+{
+	(void)output;
+	
+	size_t length;
+	const unsigned char * data = byte_source_acquire(input, &length);
+	
+	if(!data){
+		return byte_source_is_closed(input) ? pipeline_stage_done : pipeline_stage_idle;
+	}
+	
+	check_stage_result * result = self->result;
+	
+	for(size_t i = 0; i < length; i++){
+		result->mismatches += data[i] != (unsigned char)(result->length + i + self->increment);
+	}
+	
+	result->length += length;
+	result->blocks++;
+	byte_source_commit(input, length);
+	return pipeline_stage_progress;
+}
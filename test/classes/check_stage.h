@@ -0,0 +1,36 @@
+#ifndef CHECK_STAGE_H_
+#define CHECK_STAGE_H_
+
+// the last stage of a test pipeline, checking it's input is the sequence of sequence_stage,
+// with each byte incremented by increment. The result is counted into a check_stage_result
+// owned by the test.
+
+#include "interfaces/byte_source.h"
+#include "interfaces/byte_sink.h"
+
+typedef struct check_stage_result {
+	size_t length;
+	size_t mismatches;
+	size_t blocks;
+} check_stage_result;
+
+#define COBJ_CLASS_NAME	check_stage
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(unsigned char, increment)	\
+	COBJ_CLASS_PARAMETER(check_stage_result *, result)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(unsigned char, increment)	\
+	COBJ_CLASS_VARIABLE(check_stage_result *, result)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(pipeline_stage)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "interfaces/pipeline_stage.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+#endif /* CHECK_STAGE_H_ */
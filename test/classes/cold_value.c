@@ -0,0 +1,35 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "cold_value.h"
+
+#include <string.h>
+
+static bool initialize_impl(cold_value_impl * self, int value, const char * name)
+{
+	if(!self->cold || !name || strlen(name) >= sizeof(self->cold->name)){
+		return false;
+	}
+	
+	self->value = value;
+	strcpy(self->cold->name, name);
+	self->cold->name_reads = 0;
+	return true;
+}
+
+static int value_get_impl(cold_value_impl * self)
+{
+	return self->value;
+}
+
+#ifdef VALUE_V2
+static void value_set_impl(cold_value_impl * self, int value)
+{
+	self->value = value;
+}
+#endif
+
+static const char * label_text_impl(cold_value_impl * self)
+{
+	self->cold->name_reads++;
+	return self->cold->name;
+}
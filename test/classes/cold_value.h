@@ -0,0 +1,29 @@
+#ifndef COLD_VALUE_H_
+#define COLD_VALUE_H_
+
+// a value with it's name in cold variables, aligned to a cache-line, for the test of the layout.
+
+#define COBJ_CLASS_NAME	cold_value
+#define COBJ_CLASS_ALIGN	64
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(int, value)	\
+	COBJ_CLASS_PARAMETER(const char *, name)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(int, value)	\
+	COBJ_CLASS_VARIABLE_COLD(char, name[32])	\
+	COBJ_CLASS_VARIABLE_COLD(int, name_reads)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(value)	\
+	COBJ_CLASS_INTERFACE(label)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "../interfaces/value.h"
+#include "../interfaces/label.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+#endif /* COLD_VALUE_H_ */
@@ -0,0 +1,51 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "counted_grid.h"
+
+#include <string.h>
+
+static bool initialize_impl(counted_grid_impl * self, counted_grid_calls * calls)
+{
+	if(!calls){
+		return false;
+	}
+	
+	self->calls = calls;
+	memset(self->cells, 0, sizeof(self->cells));
+	return true;
+}
+
+static int grid_cell_impl(counted_grid_impl * self, int row, int column)
+{
+	self->calls->cell++;
+	return self->cells[row][column];
+}
+
+static int grid_sum_impl(counted_grid_impl * self)
+{
+	self->calls->sum++;
+	
+	int sum = 0;
+	for(int row = 0; row < COUNTED_GRID_SIZE; row++){
+		for(int column = 0; column < COUNTED_GRID_SIZE; column++){
+			sum += self->cells[row][column];
+		}
+	}
+	return sum;
+}
+
+static void grid_set_cell_impl(counted_grid_impl * self, int row, int column, int value)
+{
+	self->cells[row][column] = value;
+}
+
+static void grid_clear_impl(counted_grid_impl * self)
+{
+	memset(self->cells, 0, sizeof(self->cells));
+}
+
+static int grid_size_impl(counted_grid_impl * self)
+{
+	(void)self;
+	return COUNTED_GRID_SIZE;
+}
@@ -0,0 +1,34 @@
+#ifndef COUNTED_GRID_H_
+#define COUNTED_GRID_H_
+
+// a grid of COUNTED_GRID_SIZE * COUNTED_GRID_SIZE cells, counting the calls of it's pure methods
+// into a counted_grid_calls owned by the test.
+
+#define COUNTED_GRID_SIZE	4
+
+typedef struct counted_grid_calls {
+	int cell;
+	int sum;
+} counted_grid_calls;
+
+typedef int counted_grid_cells[COUNTED_GRID_SIZE][COUNTED_GRID_SIZE];
+
+#define COBJ_CLASS_NAME	counted_grid
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(counted_grid_calls *, calls)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(counted_grid_calls *, calls)	\
+	COBJ_CLASS_VARIABLE(counted_grid_cells, cells)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(grid)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "../interfaces/grid.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+#endif /* COUNTED_GRID_H_ */
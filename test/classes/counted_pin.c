@@ -0,0 +1,88 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "counted_pin.h"
+
+#include <time.h>
+
+static bool initialize_impl(counted_pin_impl * self, counted_pin_calls * calls)
+{
+	if(!calls){
+		return false;
+	}
+	
+	self->calls = calls;
+	self->value = false;
+	self->options = gpio_pin_options_default;
+	return true;
+}
+
+static void count(counted_pin_calls * calls, atomic_int * counter, char method)
+{
+	atomic_fetch_add(counter, 1);
+	
+	int position = atomic_fetch_add(&calls->order_length, 1);
+	if(position < (int)sizeof(calls->order) - 1){
+		calls->order[position] = method;
+	}
+}
+
+static void stay(counted_pin_calls * calls)
+{
+	if(calls->delay_ns){
+		struct timespec delay = { .tv_sec = 0, .tv_nsec = calls->delay_ns };
+		nanosleep(&delay, NULL);
+	}
+}
+
+static void read_enter(counted_pin_calls * calls)
+{
+	int readers = atomic_fetch_add(&calls->readers, 1) + 1;
+	if(atomic_load(&calls->writers)){
+		atomic_fetch_add(&calls->overlaps, 1);
+	}
+	
+	int max_readers = atomic_load(&calls->max_readers);
+	while(readers > max_readers && !atomic_compare_exchange_weak(&calls->max_readers, &max_readers, readers)){
+	}
+	
+	stay(calls);
+	atomic_fetch_sub(&calls->readers, 1);
+}
+
+static void write_enter(counted_pin_calls * calls)
+{
+	if(atomic_fetch_add(&calls->writers, 1) || atomic_load(&calls->readers)){
+		atomic_fetch_add(&calls->overlaps, 1);
+	}
+	
+	stay(calls);
+	atomic_fetch_sub(&calls->writers, 1);
+}
+
+static bool gpio_pin_get_value_impl(counted_pin_impl * self)
+{
+	count(self->calls, &self->calls->get_value, 'g');
+	read_enter(self->calls);
+	return self->value;
+}
+
+static void gpio_pin_set_value_impl(counted_pin_impl * self, bool value)
+{
+	count(self->calls, &self->calls->set_value, 'v');
+	write_enter(self->calls);
+	self->value = value;
+}
+
+static void gpio_pin_set_options_impl(counted_pin_impl * self, gpio_pin_options options)
+{
+	count(self->calls, &self->calls->set_options, 'o');
+	write_enter(self->calls);
+	self->options = options;
+}
+
+static void gpio_pin_toggle_impl(counted_pin_impl * self)
+{
+	count(self->calls, &self->calls->toggle, 't');
+	write_enter(self->calls);
+	self->value = !self->value;
+}
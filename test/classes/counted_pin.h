@@ -0,0 +1,50 @@
+#ifndef COUNTED_PIN_H_
+#define COUNTED_PIN_H_
+
+// a gpio_pin counting the calls of each method, for the tests of the decorators. The calls
+// are counted into a counted_pin_calls owned by the test, which also notes the order of the
+// calls, and the callers found inside the object together.
+
+#include <stdatomic.h>
+
+typedef struct counted_pin_calls {
+	atomic_int get_value;
+	atomic_int set_value;
+	atomic_int set_options;
+	atomic_int toggle;
+	
+	// the first letters of the methods (g, v, o, t) in the order of the calls, of a single thread
+	char order[32];
+	atomic_int order_length;
+	
+	// the callers inside the object, get_value is a reader. overlaps counts the callers, which found
+	// a writer inside, or found a reader while they write.
+	atomic_int readers;
+	atomic_int writers;
+	atomic_int max_readers;
+	atomic_int overlaps;
+	
+	// the time each call stays inside, so the callers of other threads meet
+	long delay_ns;
+} counted_pin_calls;
+
+#define COBJ_CLASS_NAME	counted_pin
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(counted_pin_calls *, calls)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(counted_pin_calls *, calls)	\
+	COBJ_CLASS_VARIABLE(bool, value)	\
+	COBJ_CLASS_VARIABLE(gpio_pin_options, options)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(gpio_pin)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "interfaces/gpio_pin.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+#endif /* COUNTED_PIN_H_ */
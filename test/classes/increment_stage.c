@@ -0,0 +1,40 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "increment_stage.h"
+
+static bool initialize_impl(increment_stage_impl * self, size_t chunk)
+{
+	if(!chunk){
+		return false;
+	}
+	
+	self->chunk = chunk;
+	return true;
+}
+
+static pipeline_stage_status pipeline_stage_process_impl(increment_stage_impl * self, const byte_source * input, const byte_sink * output)
+{
+	size_t length;
+	const unsigned char * data = byte_source_acquire(input, &length);
+	
+	if(!data){
+		return byte_source_is_closed(input) ? pipeline_stage_done : pipeline_stage_idle;
+	}
+	
+	if(length > self->chunk){
+		length = self->chunk;
+	}
+	
+	unsigned char * incremented = byte_sink_acquire(output, length);
+	if(!incremented){
+		return pipeline_stage_idle;
+	}
+	
+	for(size_t i = 0; i < length; i++){
+		incremented[i] = (unsigned char)(data[i] + 1);
+	}
+	
+	byte_sink_commit(output, length);
+	byte_source_commit(input, length);
+	return pipeline_stage_progress;
+}
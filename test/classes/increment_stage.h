@@ -0,0 +1,28 @@
+#ifndef INCREMENT_STAGE_H_
+#define INCREMENT_STAGE_H_
+
+// a stage in the middle of a test pipeline, copying it's input to it's output with each byte
+// incremented by one. It copies up to chunk bytes per block, so the blocks of the input are
+// read in parts.
+
+#include "interfaces/byte_source.h"
+#include "interfaces/byte_sink.h"
+
+#define COBJ_CLASS_NAME	increment_stage
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(size_t, chunk)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(size_t, chunk)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(pipeline_stage)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "interfaces/pipeline_stage.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+#endif /* INCREMENT_STAGE_H_ */
@@ -0,0 +1,42 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "pipe_reader.h"
+
+#include "utils.h"
+#include <unistd.h>
+
+static bool initialize_impl(pipe_reader_impl * self, int fd)
+{
+	self->fd = fd;
+	self->bytes = 0;
+	self->calls = 0;
+	self->events = 0;
+	return true;
+}
+
+static int event_source_fd_impl(pipe_reader_impl * self)
+{
+	return self->fd;
+}
+
+static uint32_t event_source_interest_impl(pipe_reader_impl * self)
+{
+	UNUSED_PARAMETER(self);
+	return event_readable;
+}
+
+static void event_source_on_ready_impl(pipe_reader_impl * self, uint32_t events)
+{
+	char buffer[16];
+	ssize_t count;
+	
+	self->calls++;
+	self->events = events;
+	
+	// the pipe is non-blocking
+	if(events & event_readable){
+		while((count = read(self->fd, buffer, sizeof(buffer))) > 0){
+			self->bytes += (int)count;
+		}
+	}
+}
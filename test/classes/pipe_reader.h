@@ -0,0 +1,28 @@
+#ifndef PIPE_READER_H_
+#define PIPE_READER_H_
+
+#include <stdint.h>
+
+// reads the read end of a pipe, and counts the bytes and the calls of on_ready
+
+#define COBJ_CLASS_NAME	pipe_reader
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(int, fd)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(int, fd)	\
+	COBJ_CLASS_VARIABLE(int, bytes)	\
+	COBJ_CLASS_VARIABLE(int, calls)	\
+	COBJ_CLASS_VARIABLE(uint32_t, events)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(event_source)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "interfaces/event_source.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+#endif /* PIPE_READER_H_ */
@@ -0,0 +1,31 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "plugin_value.h"
+
+static bool initialize_impl(plugin_value_impl * self, int value, const char * text)
+{
+	if(!text){
+		return false;
+	}
+	
+	self->value = value;
+	self->text = text;
+	return true;
+}
+
+static int value_get_impl(plugin_value_impl * self)
+{
+	return self->value;
+}
+
+#ifdef VALUE_V2
+static void value_set_impl(plugin_value_impl * self, int value)
+{
+	self->value = value;
+}
+#endif
+
+static const char * label_text_impl(plugin_value_impl * self)
+{
+	return self->text;
+}
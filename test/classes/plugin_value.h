@@ -0,0 +1,27 @@
+#ifndef PLUGIN_VALUE_H_
+#define PLUGIN_VALUE_H_
+
+// a class of test/plugin, created by the descriptor only
+
+#define COBJ_CLASS_NAME	plugin_value
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(int, value)	\
+	COBJ_CLASS_PARAMETER(const char *, text)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(int, value)	\
+	COBJ_CLASS_VARIABLE(const char *, text)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(value)	\
+	COBJ_CLASS_INTERFACE(label)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "../interfaces/value.h"
+#include "../interfaces/label.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+#endif /* PLUGIN_VALUE_H_ */
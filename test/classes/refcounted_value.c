@@ -0,0 +1,31 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "refcounted_value.h"
+
+static bool initialize_impl(refcounted_value_impl * self, int value, atomic_int * finalized)
+{
+	if(!finalized){
+		return false;
+	}
+	
+	self->value = value;
+	self->finalized = finalized;
+	return true;
+}
+
+static void finalize_impl(refcounted_value_impl * self)
+{
+	atomic_fetch_add(self->finalized, 1);
+}
+
+static int value_get_impl(refcounted_value_impl * self)
+{
+	return self->value;
+}
+
+#ifdef VALUE_V2
+static void value_set_impl(refcounted_value_impl * self, int value)
+{
+	self->value = value;
+}
+#endif
@@ -0,0 +1,28 @@
+#ifndef REFCOUNTED_VALUE_H_
+#define REFCOUNTED_VALUE_H_
+
+// a reference counted value, counting it's finalize calls into the counter passed to the initializer
+
+#include <stdatomic.h>
+
+#define COBJ_CLASS_NAME	refcounted_value
+#define COBJ_CLASS_REFCOUNTED
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(int, value)	\
+	COBJ_CLASS_PARAMETER(atomic_int *, finalized)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(int, value)	\
+	COBJ_CLASS_VARIABLE(atomic_int *, finalized)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(value)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "../interfaces/value.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+#endif /* REFCOUNTED_VALUE_H_ */
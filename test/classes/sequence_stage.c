@@ -0,0 +1,39 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "sequence_stage.h"
+
+static bool initialize_impl(sequence_stage_impl * self, size_t length, size_t chunk)
+{
+	if(!chunk){
+		return false;
+	}
+	
+	self->length = length;
+	self->chunk = chunk;
+	self->written = 0;
+	return true;
+}
+
+static pipeline_stage_status pipeline_stage_process_impl(sequence_stage_impl * self, const byte_source * input, const byte_sink * output)
+{
+	(void)input;
+	
+	if(self->written == self->length){
+		return pipeline_stage_done;
+	}
+	
+	size_t length = self->length - self->written < self->chunk ? self->length - self->written : self->chunk;
+	
+	unsigned char * data = byte_sink_acquire(output, length);
+	if(!data){
+		return pipeline_stage_idle;
+	}
+	
+	for(size_t i = 0; i < length; i++){
+		data[i] = (unsigned char)(self->written + i);
+	}
+	
+	byte_sink_commit(output, length);
+	self->written += length;
+	return pipeline_stage_progress;
+}
@@ -0,0 +1,30 @@
+#ifndef SEQUENCE_STAGE_H_
+#define SEQUENCE_STAGE_H_
+
+// the first stage of a test pipeline, writing the bytes 0, 1, 2, ... (modulo 256) to it's output,
+// chunk bytes per block, until length bytes are written.
+
+#include "interfaces/byte_source.h"
+#include "interfaces/byte_sink.h"
+
+#define COBJ_CLASS_NAME	sequence_stage
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(size_t, length)	\
+	COBJ_CLASS_PARAMETER(size_t, chunk)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(size_t, length)	\
+	COBJ_CLASS_VARIABLE(size_t, chunk)	\
+	COBJ_CLASS_VARIABLE(size_t, written)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(pipeline_stage)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "interfaces/pipeline_stage.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+#endif /* SEQUENCE_STAGE_H_ */
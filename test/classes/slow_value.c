@@ -0,0 +1,31 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "slow_value.h"
+
+#include <time.h>
+
+atomic_int slow_value_initialized_count;
+
+static bool initialize_impl(slow_value_impl * self, int value)
+{
+	atomic_fetch_add(&slow_value_initialized_count, 1);
+	
+	// long enough for the other threads to wait
+	struct timespec delay = { .tv_sec = 0, .tv_nsec = 20000000 };
+	nanosleep(&delay, NULL);
+	
+	self->value = value;
+	return value >= 0;
+}
+
+static int value_get_impl(slow_value_impl * self)
+{
+	return self->value;
+}
+
+#ifdef VALUE_V2
+static void value_set_impl(slow_value_impl * self, int value)
+{
+	self->value = value;
+}
+#endif
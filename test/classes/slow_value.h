@@ -0,0 +1,27 @@
+#ifndef SLOW_VALUE_H_
+#define SLOW_VALUE_H_
+
+// a value with a slow initializer, which counts it's calls, and fails for negative values.
+// It has a proxy initializing it on the first call (COBJ_CLASS_LAZY).
+
+#define COBJ_CLASS_NAME	slow_value
+#define COBJ_CLASS_LAZY
+
+#define COBJ_CLASS_PARAMETERS	\
+	COBJ_CLASS_PARAMETER(int, value)
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(int, value)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(value)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "../interfaces/value.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+extern atomic_int slow_value_initialized_count;
+
+#endif /* SLOW_VALUE_H_ */
@@ -0,0 +1,37 @@
+#define COBJ_IMPLEMENTATION_FILE
+
+#include "ticker.h"
+
+static bool initialize_impl(ticker_impl * self)
+{
+	self->total = 0;
+	return true;
+}
+
+static cobj_async_status counter_count_to_poll_impl(ticker_impl * self, counter_count_to_frame * frame)
+{
+	COBJ_ASYNC_LOCALS(frame, struct { int i; }, locals);
+	COBJ_ASYNC_BEGIN(frame);
+	
+	for(locals->i = 0; locals->i < frame->limit; locals->i += frame->step){
+		self->total++;
+		
+		// two resume points on one line
+		COBJ_ASYNC_YIELD(frame); COBJ_ASYNC_YIELD(frame);
+	}
+	
+	frame->result = locals->i;
+	COBJ_ASYNC_END(frame);
+}
+
+static cobj_async_status counter_wait_for_poll_impl(ticker_impl * self, counter_wait_for_frame * frame)
+{
+	COBJ_ASYNC_BEGIN(frame);
+	COBJ_ASYNC_AWAIT(frame, self->total >= frame->total);
+	COBJ_ASYNC_END(frame);
+}
+
+static int counter_total_impl(ticker_impl * self)
+{
+	return self->total;
+}
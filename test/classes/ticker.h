@@ -0,0 +1,22 @@
+#ifndef TICKER_H_
+#define TICKER_H_
+
+// counts the steps of all count_to calls
+
+#define COBJ_CLASS_NAME	ticker
+
+#define COBJ_CLASS_PARAMETERS
+
+#define COBJ_CLASS_VARIABLES	\
+	COBJ_CLASS_VARIABLE(int, total)
+
+#define COBJ_CLASS_INTERFACES	\
+	COBJ_CLASS_INTERFACE(counter)
+
+#define COBJ_INTERFACE_IMPLEMENTATION_MODE
+#include "../interfaces/counter.h"
+#undef COBJ_INTERFACE_IMPLEMENTATION_MODE
+
+#include "cobj-classheader-generator.h"
+
+#endif /* TICKER_H_ */
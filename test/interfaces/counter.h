@@ -0,0 +1,17 @@
+#ifndef COUNTER_H_
+#define COUNTER_H_
+
+// an async interface: count_to yields after each step
+
+#include "cobj-async.h"
+
+#define COBJ_INTERFACE_NAME		counter
+#define COBJ_INTERFACE_ASYNC_LOCALS	16
+#define COBJ_INTERFACE_METHODS	\
+	COBJ_INTERFACE_ASYNC_METHOD(int, count_to, int, limit, int, step)	\
+	COBJ_INTERFACE_ASYNC_METHOD(void, wait_for, int, total)	\
+	COBJ_INTERFACE_METHOD(int, total)
+
+#include "cobj-interface-generator.h"
+
+#endif /* COUNTER_H_ */
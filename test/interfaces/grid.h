@@ -0,0 +1,17 @@
+#ifndef GRID_H_
+#define GRID_H_
+
+// an interface with pure methods taking arguments, and without, for the test of the memo.
+
+#define COBJ_INTERFACE_NAME		grid
+#define COBJ_INTERFACE_WITH_MEMO
+#define COBJ_INTERFACE_METHODS	\
+	COBJ_INTERFACE_PURE_METHOD(int, cell, int, row, int, column)	\
+	COBJ_INTERFACE_PURE_METHOD(int, sum)	\
+	COBJ_INTERFACE_SETTER_METHOD(void, set_cell, int, row, int, column, int, value)	\
+	COBJ_INTERFACE_MUTATING_METHOD(void, clear)	\
+	COBJ_INTERFACE_METHOD(int, size)
+
+#include "cobj-interface-generator.h"
+
+#endif /* GRID_H_ */
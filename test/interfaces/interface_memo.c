@@ -0,0 +1,3 @@
+#define COBJ_INTERFACE_MEMO_MODE
+
+#include "grid.h"
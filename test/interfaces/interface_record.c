@@ -0,0 +1,3 @@
+#define COBJ_INTERFACE_RECORD_MODE
+
+#include "value.h"
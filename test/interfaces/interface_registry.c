@@ -0,0 +1,6 @@
+#define COBJ_INTERFACE_REGISTRY_MODE
+
+#include "counter.h"
+#include "value.h"
+#include "label.h"
+#include "grid.h"
@@ -0,0 +1,3 @@
+#define COBJ_INTERFACE_REMOTE_MODE
+
+#include "value.h"
@@ -0,0 +1,10 @@
+#ifndef LABEL_H_
+#define LABEL_H_
+
+#define COBJ_INTERFACE_NAME		label
+#define COBJ_INTERFACE_METHODS	\
+	COBJ_INTERFACE_METHOD(const char *, text)
+
+#include "cobj-interface-generator.h"
+
+#endif /* LABEL_H_ */
@@ -0,0 +1,25 @@
+#ifndef VALUE_H_
+#define VALUE_H_
+
+// an interface, which got a method in version 2. Plugins compiled without VALUE_V2
+// have the old mt, so the program compiled with VALUE_V2 can't use them.
+
+#ifdef VALUE_V2
+#	define VALUE_V2_METHODS	\
+		COBJ_INTERFACE_METHOD(void, set, int, value)
+#else
+#	define VALUE_V2_METHODS
+#endif
+
+#define COBJ_INTERFACE_NAME		value
+#define COBJ_INTERFACE_WITH_REMOTE
+#define COBJ_INTERFACE_WITH_RECORD
+#define COBJ_INTERFACE_WITH_POLY
+#define COBJ_INTERFACE_WITH_SHARED
+#define COBJ_INTERFACE_METHODS	\
+	COBJ_INTERFACE_METHOD(int, get)	\
+	VALUE_V2_METHODS
+
+#include "cobj-interface-generator.h"
+
+#endif /* VALUE_H_ */
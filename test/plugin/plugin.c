@@ -0,0 +1,7 @@
+// the plugin of test_plugin, compiled without VALUE_V2:
+// gcc -std=gnu11 -Wall -Wextra -fPIC -shared -Isrc -Idemo -Itest test/plugin/plugin.c test/classes/plugin_value.c -o test_plugin.so
+
+#include "cobj-plugin.h"
+#include "classes/plugin_value.h"
+
+COBJ_PLUGIN_EXPORT(&plugin_value_descriptor_instance);
@@ -0,0 +1,23 @@
+#ifndef TEST_H_
+#define TEST_H_
+
+// Each test is a program, returning 0 if all checks passed. The build command
+// is noted at the top of each test, run from the root of the repository.
+
+#include <stdio.h>
+
+static int test_failures;
+
+// checks the condition, and reports it if false. The test continues.
+#define CHECK(condition)	\
+	do {	\
+		if(!(condition)) {	\
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);	\
+			test_failures++;	\
+		}	\
+	} while(0)
+
+#define TEST_RESULT()	\
+	(printf("%s: %s\n", __FILE__, test_failures ? "FAILED" : "passed"), test_failures != 0)
+
+#endif /* TEST_H_ */
@@ -0,0 +1,50 @@
+// gcc -std=gnu11 -Wall -Wextra -Isrc -Idemo -Itest test/test_async.c test/classes/ticker.c test/interfaces/interface_registry.c -o test_async
+
+#include "test.h"
+#include "classes/ticker.h"
+
+#define CALLS	100
+
+int main(void)
+{
+	ticker ticker_object;
+	CHECK(ticker_initialize(&ticker_object));
+	
+	counter counter_reference;
+	CHECK(counter_queryinterface(&ticker_object.object, &counter_reference));
+	
+	// the waiting call is resumed by the polls of the others
+	counter_wait_for_frame wait_frame;
+	CHECK(counter_wait_for_start(&counter_reference, &wait_frame, CALLS * 4) == COBJ_ASYNC_PENDING);
+	
+	counter_count_to_frame frames[CALLS];
+	
+	for(int i = 0; i < CALLS; ++i){
+		CHECK(counter_count_to_start(&counter_reference, &frames[i], 10, 3) == COBJ_ASYNC_PENDING);
+	}
+	
+	CHECK(counter_total(&counter_reference) == CALLS);
+	
+	int polls = 0;
+	
+	for(bool pending = true; pending; ++polls){
+		pending = false;
+		
+		for(int i = 0; i < CALLS; ++i){
+			pending |= counter_count_to_poll(&counter_reference, &frames[i]) == COBJ_ASYNC_PENDING;
+		}
+	}
+	
+	// 4 steps with 2 yields each
+	CHECK(polls == 8);
+	CHECK(counter_total(&counter_reference) == CALLS * 4);
+	
+	for(int i = 0; i < CALLS; ++i){
+		CHECK(frames[i].result == 12);
+		CHECK(frames[i].state == COBJ_ASYNC_STATE_DONE);
+	}
+	
+	CHECK(counter_wait_for_poll(&counter_reference, &wait_frame) == COBJ_ASYNC_DONE);
+	
+	return TEST_RESULT();
+}
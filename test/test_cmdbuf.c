@@ -0,0 +1,148 @@
+// gcc -std=gnu11 -Wall -Wextra -pthread -Isrc -Idemo -Itest test/test_cmdbuf.c test/classes/counted_pin.c demo/interfaces/interface_registry.c demo/interfaces/interface_cmdbuf.c -o test_cmdbuf
+
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "test.h"
+#include "classes/counted_pin.h"
+
+// the commands as generated in interface_cmdbuf.c: the header of 8 bytes, and the arguments padded to 8 bytes
+#define SET_VALUE_SIZE	16
+#define TOGGLE_SIZE		8
+
+typedef struct {
+	gpio_pin_cmdbuf * commands;
+	gpio_pin * target;
+	bool executed;
+} execution;
+
+static void * execute_thread(void * context)
+{
+	execution * call = context;
+	call->executed = gpio_pin_cmdbuf_execute(call->commands, call->target);
+	return NULL;
+}
+
+int main(void)
+{
+	counted_pin_calls calls = { 0 };
+	counted_pin object;
+	CHECK(counted_pin_initialize(&object, &calls));
+	
+	gpio_pin target;
+	CHECK(gpio_pin_queryinterface(&object.object, &target));
+	
+	static uint64_t memory[64];
+	gpio_pin_cmdbuf commands;
+	CHECK(gpio_pin_cmdbuf_initialize(&commands, memory, sizeof(memory)));
+	
+	// the memory must be aligned to COBJ_CMDBUF_ALIGNMENT
+	gpio_pin_cmdbuf unaligned;
+	CHECK(!gpio_pin_cmdbuf_initialize(&unaligned, (unsigned char *)memory + 1, sizeof(memory) - 1));
+	
+	gpio_pin pin;
+	CHECK(gpio_pin_queryinterface(&commands.object, &pin));
+	
+	// the calls are captured, the target is called by the execution only
+	gpio_pin_set_options(&pin, gpio_pin_options_pullup);
+	gpio_pin_toggle(&pin);
+	gpio_pin_toggle(&pin);
+	gpio_pin_set_value(&pin, true);
+	CHECK(atomic_load(&calls.order_length) == 0);
+	
+	CHECK(gpio_pin_cmdbuf_execute(&commands, &target));
+	CHECK(strcmp(calls.order, "ottv") == 0);
+	CHECK(gpio_pin_get_value(&target));
+	
+	// a buffer can be executed again, until it's reset
+	CHECK(gpio_pin_cmdbuf_execute(&commands, &target));
+	CHECK(atomic_load(&calls.toggle) == 4);
+	
+	gpio_pin_cmdbuf_reset(&commands);
+	memset(&calls, 0, sizeof(calls));
+	CHECK(gpio_pin_cmdbuf_execute(&commands, &target));
+	CHECK(atomic_load(&calls.order_length) == 0);
+	
+	// a setter called again replaces the last command, if it's the same method
+	gpio_pin_set_value(&pin, true);
+	gpio_pin_set_value(&pin, false);
+	gpio_pin_set_value(&pin, true);
+	gpio_pin_toggle(&pin);
+	gpio_pin_set_value(&pin, false);
+	gpio_pin_set_options(&pin, gpio_pin_options_pulldown);
+	gpio_pin_set_options(&pin, gpio_pin_options_default);
+	
+	CHECK(gpio_pin_cmdbuf_execute(&commands, &target));
+	CHECK(strcmp(calls.order, "vtvo") == 0);
+	CHECK(!gpio_pin_get_value(&target));
+	
+	// pure methods are not captured, and return a zero result
+	gpio_pin_cmdbuf_reset(&commands);
+	memset(&calls, 0, sizeof(calls));
+	gpio_pin_set_value(&target, true);
+	
+	CHECK(!gpio_pin_get_value(&pin));
+	CHECK(commands.private_data.buffer.size == 0);
+	CHECK(gpio_pin_cmdbuf_execute(&commands, &target));
+	CHECK(atomic_load(&calls.get_value) == 0);
+	
+	// a buffer with a command of another interface executes nothing
+	gpio_pin_toggle(&pin);
+	gpio_pin_set_value(&pin, false);
+	
+	cobj_cmdbuf_header * second = (cobj_cmdbuf_header *)(commands.private_data.buffer.memory + commands.private_data.buffer.last);
+	uint32_t method = second->method;
+	second->method = 1000;
+	
+	memset(&calls, 0, sizeof(calls));
+	CHECK(!gpio_pin_cmdbuf_execute(&commands, &target));
+	CHECK(atomic_load(&calls.order_length) == 0);
+	
+	second->method = method;
+	CHECK(gpio_pin_cmdbuf_execute(&commands, &target));
+	CHECK(strcmp(calls.order, "tv") == 0);
+	
+	// the commands not fitting into the buffer are dropped, and the buffer isn't executed
+	static uint64_t small_memory[(SET_VALUE_SIZE + TOGGLE_SIZE + 8) / sizeof(uint64_t)];
+	gpio_pin_cmdbuf small_commands;
+	CHECK(gpio_pin_cmdbuf_initialize(&small_commands, small_memory, sizeof(small_memory)));
+	
+	gpio_pin small_pin;
+	CHECK(gpio_pin_queryinterface(&small_commands.object, &small_pin));
+	
+	gpio_pin_set_value(&small_pin, true);
+	gpio_pin_toggle(&small_pin);
+	CHECK(!small_commands.private_data.buffer.overflow);
+	gpio_pin_set_value(&small_pin, false);
+	CHECK(small_commands.private_data.buffer.overflow);
+	
+	memset(&calls, 0, sizeof(calls));
+	CHECK(!gpio_pin_cmdbuf_execute(&small_commands, &target));
+	CHECK(atomic_load(&calls.order_length) == 0);
+	
+	gpio_pin_cmdbuf_reset(&small_commands);
+	gpio_pin_toggle(&small_pin);
+	CHECK(gpio_pin_cmdbuf_execute(&small_commands, &target));
+	CHECK(strcmp(calls.order, "t") == 0);
+	
+	// filled by this thread, executed by another one
+	gpio_pin_cmdbuf_reset(&commands);
+	memset(&calls, 0, sizeof(calls));
+	
+	for(int i = 0; i < 10; ++i){
+		gpio_pin_toggle(&pin);
+		gpio_pin_set_options(&pin, gpio_pin_options_pullup);
+	}
+	
+	execution call = { .commands = &commands, .target = &target, .executed = false };
+	pthread_t thread;
+	CHECK(pthread_create(&thread, NULL, &execute_thread, &call) == 0);
+	pthread_join(thread, NULL);
+	
+	CHECK(call.executed);
+	CHECK(atomic_load(&calls.toggle) == 10);
+	CHECK(atomic_load(&calls.set_options) == 10);
+	
+	return TEST_RESULT();
+}
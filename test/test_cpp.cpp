@@ -0,0 +1,74 @@
+// gcc -std=gnu11 -Wall -Wextra -c -DVALUE_V2 -Isrc -Idemo -Itest test/classes/plugin_value.c test/interfaces/interface_registry.c
+// g++ -std=c++20 -Wall -Wextra -DVALUE_V2 -Isrc -Idemo -Itest test/test_cpp.cpp plugin_value.o interface_registry.o -o test_cpp
+
+#include <cstring>
+
+#include "test.h"
+#include "classes/plugin_value.h"
+#include "interfaces/counter.h"
+
+// the traits are constant expressions
+static_assert(std::strlen(cobj::interface_traits<value>::name) == 5);
+static_assert(cobj::interface_traits<value>::methods_count == 2);
+static_assert(cobj::interface_traits<label>::methods_count == 1);
+static_assert(cobj::interface_traits<value>::descriptor == &value_descriptor);
+static_assert(cobj::class_traits<plugin_value>::descriptor == &plugin_value_descriptor_instance);
+static_assert(cobj::class_traits<plugin_value>::name[0] == 'p');
+
+// the concepts
+static_assert(cobj::interface<value>);
+static_assert(cobj::object<plugin_value>);
+static_assert(cobj::implements<plugin_value, value>);
+static_assert(cobj::implements<plugin_value, label>);
+static_assert(!cobj::implements<plugin_value, counter>);
+static_assert(!cobj::implements<value, value>);
+
+// static dispatch, for any class implementing value
+template<cobj::implements<value> T>
+static int increment_static(T & object)
+{
+	cobj::ref<value, T> reference(object);
+	reference.set(reference.get() + 1);
+	return reference.get();
+}
+
+// dynamic dispatch
+static int increment_dynamic(cobj::ref<value> reference)
+{
+	reference.set(reference.get() + 1);
+	return reference.get();
+}
+
+int main()
+{
+	plugin_value object;
+	CHECK(plugin_value_initialize(&object, 1, "object"));
+	
+	CHECK(increment_static(object) == 2);
+	CHECK(increment_dynamic(object) == 3);
+	
+	// the reference of a known class uses the mt of the class, without queryinterface
+	cobj::ref<value> dynamic_reference(object);
+	CHECK(dynamic_reference.reference.mt == &plugin_value_value_mt);
+	CHECK(dynamic_reference.reference.object == &object.object);
+	
+	// the static reference converts to the dynamic one
+	cobj::ref<value, plugin_value> static_reference(object);
+	cobj::ref<value> converted = static_reference;
+	CHECK(converted.reference.mt == &plugin_value_value_mt);
+	CHECK(converted.get() == 3);
+	
+	// queried, and passed to the C functions
+	cobj::ref<label> text;
+	CHECK(cobj::ref<label>::query(&object.object, text));
+	CHECK(std::strcmp(text.text(), "object") == 0);
+	CHECK(std::strcmp(label_text(&static_cast<const label &>(text)), "object") == 0);
+	
+	cobj::ref<counter> missing;
+	CHECK(!cobj::ref<counter>::query(&object.object, missing));
+	
+	value_set(&static_cast<const value &>(dynamic_reference), 10);
+	CHECK(static_reference.get() == 10);
+	
+	return TEST_RESULT();
+}
@@ -0,0 +1,62 @@
+// gcc -std=gnu11 -Wall -Wextra -Isrc -Idemo -Itest test/test_delegates.c test/classes/buffer_console.c demo/interfaces/interface_registry.c -o test_delegates
+
+#include <string.h>
+
+#include "test.h"
+#include "classes/buffer_console.h"
+
+// code using the base interface only, called with a delegate bound on the derived interface
+static void write_twice(writer_write_delegate write, const char * text)
+{
+	writer_write_delegate_call(write, text, strlen(text));
+	writer_write_delegate_call(write, text, strlen(text));
+}
+
+static int call_vprintf(console_vprintf_delegate vprintf_delegate, const char * format, ...)
+{
+	va_list vlist;
+	va_start(vlist, format);
+	int length = console_vprintf_delegate_call(vprintf_delegate, format, vlist);
+	va_end(vlist);
+	
+	return length;
+}
+
+int main(void)
+{
+	char buffer[64];
+	buffer_console object;
+	CHECK(buffer_console_initialize(&object, buffer, sizeof(buffer)));
+	
+	console console_reference;
+	CHECK(console_queryinterface(&object.object, &console_reference));
+	
+	// a method of the interface itself
+	console_vprintf_delegate vprintf_delegate = console_vprintf_bind(&console_reference);
+	CHECK(vprintf_delegate.object == &object.object);
+	CHECK(vprintf_delegate.method == console_reference.mt->vprintf);
+	CHECK(call_vprintf(vprintf_delegate, "%s-%d", "a", 1) == 3);
+	CHECK(strcmp(buffer, "a-1") == 0);
+	
+	// a method of the base, the delegate is the one of the base interface
+	console_write_delegate write = console_write_bind(&console_reference);
+	CHECK(write.object == &object.object);
+	CHECK(write.method == console_reference.mt->writer.write);
+	CHECK(console_write_delegate_call(write, "b", 1) == 1);
+	write_twice(write, "cd");
+	CHECK(strcmp(buffer, "a-1bcdcd") == 0);
+	
+	// bound on the base reference, it's the same delegate
+	writer writer_reference = console_as_writer(&console_reference);
+	writer_write_delegate base_write = writer_write_bind(&writer_reference);
+	CHECK(base_write.method == write.method && base_write.object == write.object);
+	write_twice(base_write, "e");
+	CHECK(strcmp(buffer, "a-1bcdcdee") == 0);
+	
+	// the delegate is a copy, it's still bound after the reference is changed
+	console_reference.object = NULL;
+	CHECK(console_write_delegate_call(write, "f", 1) == 1);
+	CHECK(strcmp(buffer, "a-1bcdcdeef") == 0);
+	
+	return TEST_RESULT();
+}
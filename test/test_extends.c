@@ -0,0 +1,59 @@
+// gcc -std=gnu11 -Wall -Wextra -Isrc -Idemo -Itest test/test_extends.c test/classes/buffer_console.c demo/interfaces/interface_registry.c src/cobj.c -o test_extends
+
+#include <string.h>
+
+#include "test.h"
+#include "classes/buffer_console.h"
+
+int main(void)
+{
+	char buffer[64];
+	buffer_console object;
+	CHECK(buffer_console_initialize(&object, buffer, sizeof(buffer)));
+	
+	console console_reference;
+	CHECK(console_queryinterface(&object.object, &console_reference));
+	
+	// the methods of the base are called on the derived reference
+	CHECK(console_write(&console_reference, "ab", 2) == 2);
+	CHECK(console_printf(&console_reference, "%d", 42) == 2);
+	CHECK(strcmp(buffer, "ab42") == 0);
+	
+	// the upcast is the same mt, and the same object
+	writer writer_reference = console_as_writer(&console_reference);
+	CHECK((void *)writer_reference.mt == (void *)console_reference.mt);
+	CHECK(writer_reference.object == &object.object);
+	CHECK(writer_write(&writer_reference, "cd", 2) == 2);
+	CHECK(strcmp(buffer, "ab42cd") == 0);
+	
+	// queryinterface for the base returns the mt of the derived interface
+	writer queried_writer;
+	CHECK(writer_queryinterface(&object.object, &queried_writer));
+	CHECK((void *)queried_writer.mt == (void *)console_reference.mt);
+	CHECK(writer_write(&queried_writer, "ef", 2) == 2);
+	CHECK(strcmp(buffer, "ab42cdef") == 0);
+	
+	// the descriptor counts the methods of the base, they come first in the mt
+	CHECK(writer_descriptor->methods_count == 1);
+	CHECK(console_descriptor->methods_count == 2);
+	CHECK(console_descriptor->methods_count == sizeof(console_mt) / sizeof(void (*)(void)));
+	CHECK(*console_descriptor->base_interface == writer_descriptor);
+	CHECK(!writer_descriptor->base_interface);
+	CHECK(console_write_method_index == 0);
+	CHECK(console_vprintf_method_index == 1);
+	
+	CHECK(cobj_interface_is_compatible(console_descriptor, writer_descriptor));
+	CHECK(!cobj_interface_is_compatible(writer_descriptor, console_descriptor));
+	
+	// the reflection finds the methods of the base
+	const cobj_method_descriptor * write_method = cobj_interface_find_method(console_descriptor, "write");
+	CHECK(write_method && write_method->index == 0);
+	
+	writer_write_arguments arguments = { .buffer = "gh", .length = 2 };
+	size_t written = 0;
+	cobj_invoke(write_method, &console_reference, &arguments, &written);
+	CHECK(written == 2);
+	CHECK(strcmp(buffer, "ab42cdefgh") == 0);
+	
+	return TEST_RESULT();
+}
@@ -0,0 +1,178 @@
+// gcc -std=gnu11 -Wall -Wextra -pthread -Isrc -Idemo -Itest test/test_gpio_events.c test/classes/counted_pin.c demo/classes/sim_gpio_port.c demo/classes/gpio_event_poller.c demo/events/gpio_subscriber_list.c demo/interfaces/interface_registry.c -o test_gpio_events
+
+#include <string.h>
+#include <pthread.h>
+
+#include "test.h"
+#include "classes/sim_gpio_port.h"
+#include "classes/gpio_event_poller.h"
+#include "classes/counted_pin.h"
+
+#define TOGGLES	20000
+
+// the edges a subscriber got, and the events after it has been unsubscribed
+typedef struct {
+	atomic_int rising[SIM_GPIO_PORT_PIN_COUNT];
+	atomic_int falling[SIM_GPIO_PORT_PIN_COUNT];
+	atomic_bool subscribed;
+	atomic_int late;
+} events;
+
+static void count_event(void * context, int pin_nr, gpio_edge edge)
+{
+	events * received = context;
+	
+	if(!atomic_load(&received->subscribed)){
+		atomic_fetch_add(&received->late, 1);
+	}
+	
+	atomic_fetch_add(edge == gpio_edge_rising ? &received->rising[pin_nr] : &received->falling[pin_nr], 1);
+}
+
+static void subscription_initialize(gpio_event_subscription * subscription, events * received, uint32_t pin_mask, gpio_edge edges)
+{
+	memset(received, 0, sizeof(*received));
+	atomic_store(&received->subscribed, true);
+	
+	subscription->callback = &count_event;
+	subscription->context = received;
+	subscription->pin_mask = pin_mask;
+	subscription->edges = edges;
+}
+
+// toggles pin 0 of the port, while the main thread changes the subscribers
+static void * toggle_thread(void * port)
+{
+	for(int i = 0; i < TOGGLES; ++i){
+		sim_gpio_port_set_level(port, 0, !(i & 1));
+	}
+	return NULL;
+}
+
+int main(void)
+{
+	sim_gpio_port port;
+	CHECK(sim_gpio_port_initialize(&port));
+	
+	gpio_event_source source;
+	CHECK(gpio_event_source_queryinterface(&port.object, &source));
+	
+	// each subscriber gets the edges it subscribed, of the pins it subscribed
+	gpio_event_subscription both_subscription, rising_subscription, falling_subscription;
+	events both, rising, falling;
+	subscription_initialize(&both_subscription, &both, 0x3, gpio_edge_both);
+	subscription_initialize(&rising_subscription, &rising, 0x2, gpio_edge_rising);
+	subscription_initialize(&falling_subscription, &falling, 0x4, gpio_edge_falling);
+	
+	CHECK(gpio_event_source_subscribe(&source, &both_subscription));
+	CHECK(gpio_event_source_subscribe(&source, &rising_subscription));
+	CHECK(gpio_event_source_subscribe(&source, &falling_subscription));
+	
+	sim_gpio_port_set_levels(&port, 0x7);
+	sim_gpio_port_set_levels(&port, 0x7);
+	CHECK(sim_gpio_port_set_level(&port, 1, false));
+	CHECK(sim_gpio_port_set_level(&port, 1, false));
+	CHECK(sim_gpio_port_set_level(&port, 2, false));
+	CHECK(!sim_gpio_port_set_level(&port, SIM_GPIO_PORT_PIN_COUNT, true));
+	CHECK(!sim_gpio_port_set_level(&port, -1, true));
+	
+	CHECK(atomic_load(&both.rising[0]) == 1 && atomic_load(&both.falling[0]) == 0);
+	CHECK(atomic_load(&both.rising[1]) == 1 && atomic_load(&both.falling[1]) == 1);
+	CHECK(atomic_load(&both.rising[2]) == 0 && atomic_load(&both.falling[2]) == 0);
+	CHECK(atomic_load(&rising.rising[1]) == 1 && atomic_load(&rising.falling[1]) == 0);
+	CHECK(atomic_load(&rising.rising[0]) == 0);
+	CHECK(atomic_load(&falling.falling[2]) == 1 && atomic_load(&falling.rising[2]) == 0);
+	
+	// unsubscribed, it gets no more events
+	gpio_event_source_unsubscribe(&source, &rising_subscription);
+	atomic_store(&rising.subscribed, false);
+	sim_gpio_port_set_levels(&port, 0);
+	sim_gpio_port_set_levels(&port, 0x7);
+	CHECK(atomic_load(&rising.late) == 0);
+	CHECK(atomic_load(&both.rising[1]) == 2);
+	
+	// the list has GPIO_SUBSCRIBER_LIST_CAPACITY entries, two are used
+	gpio_event_subscription more_subscriptions[GPIO_SUBSCRIBER_LIST_CAPACITY];
+	events more[GPIO_SUBSCRIBER_LIST_CAPACITY];
+	
+	for(int i = 0; i < GPIO_SUBSCRIBER_LIST_CAPACITY; ++i){
+		subscription_initialize(&more_subscriptions[i], &more[i], 0x1, gpio_edge_both);
+		CHECK(gpio_event_source_subscribe(&source, &more_subscriptions[i]) == (i < GPIO_SUBSCRIBER_LIST_CAPACITY - 2));
+	}
+	
+	for(int i = 0; i < GPIO_SUBSCRIBER_LIST_CAPACITY - 2; ++i){
+		gpio_event_source_unsubscribe(&source, &more_subscriptions[i]);
+	}
+	
+	// unsubscribing an unknown subscription changes nothing
+	gpio_event_source_unsubscribe(&source, &rising_subscription);
+	CHECK(gpio_event_source_subscribe(&source, &rising_subscription));
+	gpio_event_source_unsubscribe(&source, &rising_subscription);
+	
+	// subscribers change while another thread dispatches: the subscriber staying gets all events,
+	// the others none after unsubscribe returned
+	sim_gpio_port_set_levels(&port, 0);
+	subscription_initialize(&both_subscription, &both, 0x1, gpio_edge_both);
+	
+	pthread_t toggler;
+	CHECK(pthread_create(&toggler, NULL, &toggle_thread, &port.object) == 0);
+	
+	for(int i = 0; i < 1000; ++i){
+		events * received = &more[i % 2];
+		gpio_event_subscription * subscription = &more_subscriptions[i % 2];
+		subscription_initialize(subscription, received, 0x1, gpio_edge_both);
+		
+		CHECK(gpio_event_source_subscribe(&source, subscription));
+		gpio_event_source_unsubscribe(&source, subscription);
+		atomic_store(&received->subscribed, false);
+		CHECK(atomic_load(&received->late) == 0);
+	}
+	
+	pthread_join(toggler, NULL);
+	CHECK(atomic_load(&both.rising[0]) == TOGGLES / 2);
+	CHECK(atomic_load(&both.falling[0]) == TOGGLES / 2);
+	CHECK(atomic_load(&more[0].late) == 0);
+	CHECK(atomic_load(&more[1].late) == 0);
+	
+	gpio_event_source_unsubscribe(&source, &both_subscription);
+	gpio_event_source_unsubscribe(&source, &falling_subscription);
+	
+	// the poller reads the pins, and raises the events of the changed pins only
+	counted_pin_calls calls[3] = { 0 };
+	counted_pin pin_objects[3];
+	gpio_pin pins[3];
+	
+	for(int i = 0; i < 3; ++i){
+		CHECK(counted_pin_initialize(&pin_objects[i], &calls[i]));
+		CHECK(gpio_pin_queryinterface(&pin_objects[i].object, &pins[i]));
+	}
+	
+	gpio_pin_set_value(&pins[1], true);
+	
+	gpio_event_poller poller;
+	CHECK(gpio_event_poller_initialize(&poller, pins, 3));
+	CHECK(gpio_event_source_queryinterface(&poller.object, &source));
+	
+	subscription_initialize(&both_subscription, &both, 0x7, gpio_edge_both);
+	CHECK(gpio_event_source_subscribe(&source, &both_subscription));
+	
+	// the levels at the initialization are no change
+	CHECK(!gpio_event_poller_poll(&poller));
+	
+	gpio_pin_set_value(&pins[0], true);
+	gpio_pin_set_value(&pins[1], false);
+	CHECK(gpio_event_poller_poll(&poller));
+	CHECK(!gpio_event_poller_poll(&poller));
+	
+	CHECK(atomic_load(&both.rising[0]) == 1 && atomic_load(&both.falling[0]) == 0);
+	CHECK(atomic_load(&both.rising[1]) == 0 && atomic_load(&both.falling[1]) == 1);
+	CHECK(atomic_load(&both.rising[2]) == 0 && atomic_load(&both.falling[2]) == 0);
+	
+	gpio_event_source_unsubscribe(&source, &both_subscription);
+	
+	// the poller takes up to 32 pins
+	gpio_event_poller too_many;
+	CHECK(!gpio_event_poller_initialize(&too_many, pins, 33));
+	
+	return TEST_RESULT();
+}
@@ -0,0 +1,74 @@
+// gcc -std=gnu11 -Wall -Wextra -Isrc -Idemo -Itest test/test_init.c test/classes/slow_value.c test/interfaces/interface_registry.c src/cobj-init.c src/cobj-lazy.c -o test_init -lpthread
+
+#include "test.h"
+#include "cobj-init.h"
+#include "interfaces/value.h"
+#include "classes/slow_value.h"
+
+// each initializer takes 20ms (see classes/slow_value.c)
+#define INITIALIZE_NS	20000000u
+
+static slow_value first, second, failing, skipped, skipped_too;
+static const slow_value_parameters positive = { .value = 1 };
+static const slow_value_parameters negative = { .value = -1 };
+
+static cobj_init_node nodes[] = {
+	COBJ_INIT_NODE(slow_value, first, NULL, &positive),
+	COBJ_INIT_NODE(slow_value, second, NULL, &positive,
+		COBJ_INIT_DEPENDENCIES(&nodes[0])),
+	COBJ_INIT_NODE(slow_value, failing, NULL, &negative),
+	COBJ_INIT_NODE(slow_value, skipped, NULL, &positive,
+		COBJ_INIT_DEPENDENCIES(&nodes[0], &nodes[2])),
+	COBJ_INIT_NODE(slow_value, skipped_too, NULL, &positive,
+		COBJ_INIT_DEPENDENCIES(&nodes[3])),
+};
+
+#define NODE_COUNT	(sizeof(nodes) / sizeof(nodes[0]))
+
+static slow_value cycle_a, cycle_b;
+
+static cobj_init_node cycle[] = {
+	COBJ_INIT_NODE(slow_value, cycle_a, NULL, &positive,
+		COBJ_INIT_DEPENDENCIES(&cycle[1])),
+	COBJ_INIT_NODE(slow_value, cycle_b, NULL, &positive,
+		COBJ_INIT_DEPENDENCIES(&cycle[0])),
+};
+
+// depends on a node of another array
+static cobj_init_node outside[] = {
+	COBJ_INIT_NODE(slow_value, cycle_a, NULL, &positive,
+		COBJ_INIT_DEPENDENCIES(&nodes[0])),
+};
+
+int main(void)
+{
+	pthread_t threads[4];
+	
+	CHECK(!cobj_init_check(cycle, 2));
+	CHECK(!cobj_init_run(cycle, 2, threads, 4));
+	CHECK(atomic_load(&slow_value_initialized_count) == 0);
+	CHECK(!cobj_init_check(outside, 1));
+	
+	CHECK(cobj_init_check(nodes, NODE_COUNT));
+	CHECK(!cobj_init_run(nodes, NODE_COUNT, threads, 4));
+	
+	CHECK(nodes[0].status == cobj_init_status_initialized);
+	CHECK(nodes[1].status == cobj_init_status_initialized);
+	CHECK(nodes[2].status == cobj_init_status_failed);
+	CHECK(nodes[3].status == cobj_init_status_skipped);
+	CHECK(nodes[4].status == cobj_init_status_skipped);
+	
+	// the skipped initializers are not called
+	CHECK(atomic_load(&slow_value_initialized_count) == 3);
+	CHECK(nodes[3].duration_ns == 0 && nodes[4].duration_ns == 0);
+	
+	// a dependent starts after it's dependency, independent nodes at the same time
+	CHECK(nodes[0].duration_ns >= INITIALIZE_NS);
+	CHECK(nodes[1].start_ns >= nodes[0].start_ns + nodes[0].duration_ns);
+	CHECK(nodes[2].start_ns < nodes[0].start_ns + nodes[0].duration_ns);
+	
+	value reference;
+	CHECK(value_queryinterface(&second.object, &reference) && value_get(&reference) == 1);
+	
+	return TEST_RESULT();
+}
@@ -0,0 +1,50 @@
+// gcc -std=gnu11 -Wall -Wextra -Isrc -Idemo -Itest test/test_layout.c test/classes/cold_value.c test/interfaces/interface_registry.c -o test_layout
+
+#include <string.h>
+#include <stdint.h>
+
+#include "test.h"
+#include "classes/cold_value.h"
+
+// the hot variables: the class_descriptor, value, and the link to the cold variables
+#define HOT_SIZE	(sizeof(void *) + sizeof(int) + sizeof(void *))
+
+static cold_value objects[2];
+static cold_value_cold colds[2];
+
+int main(void)
+{
+	// the layout report
+	CHECK(cold_value_layout_size == 64);
+	CHECK(cold_value_layout_hot_size == HOT_SIZE);
+	CHECK(cold_value_layout_padding == 64 - HOT_SIZE);
+	CHECK(cold_value_layout_cold_size == sizeof(cold_value_cold));
+	CHECK(cold_value_layout_cold_size >= 32 + sizeof(int));
+	
+	// each object has it's own cache-line
+	CHECK(_Alignof(cold_value) == 64);
+	CHECK(sizeof(objects) == 2 * 64);
+	CHECK((uintptr_t)&objects[0] % 64 == 0);
+	CHECK((uintptr_t)&objects[1] - (uintptr_t)&objects[0] == 64);
+	
+	// the cold variables are linked, and read by the methods
+	CHECK(!cold_value_initialize(&objects[0], NULL, 1, "first"));
+	CHECK(cold_value_initialize(&objects[0], &colds[0], 1, "first"));
+	CHECK(cold_value_initialize(&objects[1], &colds[1], 2, "second"));
+	CHECK(objects[0].private_data.cold == &colds[0]);
+	CHECK(objects[1].private_data.cold == &colds[1]);
+	CHECK(strcmp(colds[1].name, "second") == 0);
+	
+	for(int i = 0; i < 2; i++){
+		value object_value;
+		label object_label;
+		CHECK(value_queryinterface(&objects[i].object, &object_value));
+		CHECK(label_queryinterface(&objects[i].object, &object_label));
+		
+		CHECK(value_get(&object_value) == i + 1);
+		CHECK(strcmp(label_text(&object_label), i ? "second" : "first") == 0);
+		CHECK(colds[i].name_reads == 1);
+	}
+	
+	return TEST_RESULT();
+}
@@ -0,0 +1,62 @@
+// gcc -std=gnu11 -Wall -Wextra -Isrc -Idemo -Itest test/test_lazy.c test/classes/slow_value.c test/interfaces/interface_registry.c src/cobj-lazy.c -o test_lazy -lpthread
+
+#include "test.h"
+#include "interfaces/value.h"
+#include "classes/slow_value.h"
+
+#include <pthread.h>
+
+#define THREADS	8
+
+static slow_value_lazy shared_value;
+
+static void * get_value(void * result)
+{
+	value reference = slow_value_lazy_as_value(&shared_value);
+	*(int *)result = value_get(&reference);
+	return NULL;
+}
+
+int main(void)
+{
+	// the threads calling the first method at the same time initialize it once
+	CHECK(slow_value_lazy_initialize(&shared_value, 42));
+	CHECK(atomic_load(&slow_value_initialized_count) == 0);
+	
+	pthread_t threads[THREADS];
+	int results[THREADS];
+	
+	for(int i = 0; i < THREADS; i++){
+		CHECK(pthread_create(&threads[i], NULL, &get_value, &results[i]) == 0);
+	}
+	
+	for(int i = 0; i < THREADS; i++){
+		pthread_join(threads[i], NULL);
+		CHECK(results[i] == 42);
+	}
+	
+	CHECK(atomic_load(&slow_value_initialized_count) == 1);
+	CHECK(slow_value_lazy_resolve(&shared_value));
+	
+	// the proxy is found by queryinterface too
+	value reference;
+	CHECK(value_queryinterface(&shared_value.object, &reference) && value_get(&reference) == 42);
+	
+	// a failed initializer isn't called again, and the methods return zero
+	static slow_value_lazy failing;
+	CHECK(slow_value_lazy_initialize(&failing, -1));
+	CHECK(!slow_value_lazy_resolve(&failing));
+	CHECK(!slow_value_lazy_resolve(&failing));
+	
+	reference = slow_value_lazy_as_value(&failing);
+	CHECK(value_get(&reference) == 0);
+	CHECK(atomic_load(&slow_value_initialized_count) == 2);
+	
+	// by the descriptor
+	static slow_value_lazy generic;
+	slow_value_parameters parameters = { .value = 7 };
+	CHECK(slow_value_lazy_descriptor->initialize(&generic.object, NULL, &parameters));
+	CHECK(value_queryinterface(&generic.object, &reference) && value_get(&reference) == 7);
+	
+	return TEST_RESULT();
+}
@@ -0,0 +1,123 @@
+// gcc -std=gnu11 -Wall -Wextra -Isrc -Idemo -Itest test/test_memo.c test/classes/counted_grid.c test/classes/counted_pin.c test/interfaces/interface_registry.c demo/interfaces/interface_registry.c test/interfaces/interface_memo.c demo/interfaces/interface_memo.c -o test_memo
+
+#include "test.h"
+#include "interfaces/grid.h"
+#include "interfaces/gpio_pin.h"
+#include "classes/counted_grid.h"
+#include "classes/counted_pin.h"
+
+int main(void)
+{
+	counted_grid_calls calls = { 0 };
+	counted_grid object;
+	CHECK(counted_grid_initialize(&object, &calls));
+	
+	grid target;
+	CHECK(grid_queryinterface(&object.object, &target));
+	
+	grid_memo memo;
+	CHECK(grid_memo_initialize(&memo, &target));
+	
+	grid cached;
+	CHECK(grid_queryinterface(&memo.object, &cached));
+	
+	grid_set_cell(&target, 1, 2, 12);
+	grid_set_cell(&target, 2, 1, 21);
+	
+	// the same arguments hit, other arguments miss
+	CHECK(grid_cell(&cached, 1, 2) == 12);
+	CHECK(grid_cell(&cached, 1, 2) == 12);
+	CHECK(calls.cell == 1);
+	
+	CHECK(grid_cell(&cached, 2, 1) == 21);
+	CHECK(calls.cell == 2);
+	CHECK(grid_cell(&cached, 1, 2) == 12);
+	CHECK(grid_cell(&cached, 2, 1) == 21);
+	CHECK(calls.cell == 2);
+	
+	// without arguments, the key is memo_none
+	CHECK(grid_sum(&cached) == 33);
+	CHECK(grid_sum(&cached) == 33);
+	CHECK(calls.sum == 1);
+	
+	// the other methods are forwarded, and keep the results
+	uint64_t generation = memo.private_data.generation;
+	CHECK(grid_size(&cached) == COUNTED_GRID_SIZE);
+	CHECK(memo.private_data.generation == generation);
+	CHECK(grid_cell(&cached, 1, 2) == 12);
+	CHECK(calls.cell == 2);
+	
+	// a setter invalidates all results
+	grid_set_cell(&cached, 1, 2, 5);
+	CHECK(memo.private_data.generation == generation + 1);
+	CHECK(grid_cell(&cached, 1, 2) == 5);
+	CHECK(grid_cell(&cached, 2, 1) == 21);
+	CHECK(grid_sum(&cached) == 26);
+	CHECK(calls.cell == 4);
+	CHECK(calls.sum == 2);
+	
+	// a mutating method too
+	grid_clear(&cached);
+	CHECK(memo.private_data.generation == generation + 2);
+	CHECK(grid_cell(&cached, 2, 1) == 0);
+	CHECK(grid_sum(&cached) == 0);
+	CHECK(calls.cell == 5);
+	CHECK(calls.sum == 3);
+	
+	// changed bypassing the memo, the results are stale until invalidated
+	CHECK(grid_cell(&cached, 3, 3) == 0);
+	grid_set_cell(&target, 3, 3, 33);
+	CHECK(grid_cell(&cached, 3, 3) == 0);
+	CHECK(grid_sum(&cached) == 0);
+	
+	grid_memo_invalidate(&memo);
+	CHECK(grid_cell(&cached, 3, 3) == 33);
+	CHECK(grid_sum(&cached) == 33);
+	CHECK(calls.sum == 4);
+	
+	// the slots are reused in turn, the oldest result is called again
+	const int slots = sizeof(memo.private_data.cell_cache.entries) / sizeof(memo.private_data.cell_cache.entries[0]);
+	calls.cell = 0;
+	for(int column = 0; column < slots; column++){
+		grid_cell(&cached, 0, column);
+	}
+	CHECK(calls.cell == slots);
+	CHECK(grid_cell(&cached, 3, 3) == 33);
+	CHECK(calls.cell == slots + 1);
+	CHECK(grid_cell(&cached, 0, slots - 1) == 0);
+	CHECK(calls.cell == slots + 1);
+	
+	// the memo of gpio_pin, whose pure get_value has no arguments
+	counted_pin_calls pin_calls = { 0 };
+	counted_pin pin_object;
+	CHECK(counted_pin_initialize(&pin_object, &pin_calls));
+	
+	gpio_pin pin;
+	CHECK(gpio_pin_queryinterface(&pin_object.object, &pin));
+	
+	gpio_pin_memo pin_memo;
+	CHECK(gpio_pin_memo_initialize(&pin_memo, &pin));
+	
+	gpio_pin cached_pin;
+	CHECK(gpio_pin_queryinterface(&pin_memo.object, &cached_pin));
+	
+	CHECK(!gpio_pin_get_value(&cached_pin));
+	CHECK(!gpio_pin_get_value(&cached_pin));
+	CHECK(pin_calls.get_value == 1);
+	
+	gpio_pin_toggle(&cached_pin);
+	CHECK(gpio_pin_get_value(&cached_pin));
+	CHECK(pin_calls.get_value == 2);
+	
+	gpio_pin_set_value(&cached_pin, false);
+	CHECK(!gpio_pin_get_value(&cached_pin));
+	CHECK(pin_calls.get_value == 3);
+	
+	gpio_pin_set_options(&cached_pin, gpio_pin_options_pullup);
+	CHECK(!gpio_pin_get_value(&cached_pin));
+	CHECK(!gpio_pin_get_value(&cached_pin));
+	CHECK(pin_calls.get_value == 4);
+	CHECK(pin_calls.toggle == 1 && pin_calls.set_value == 1 && pin_calls.set_options == 1);
+	
+	return TEST_RESULT();
+}
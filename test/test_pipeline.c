@@ -0,0 +1,147 @@
+// gcc -std=gnu11 -Wall -Wextra -pthread -Isrc -Idemo -Itest test/test_pipeline.c test/classes/sequence_stage.c test/classes/increment_stage.c test/classes/check_stage.c demo/classes/byte_ring.c demo/pipeline/pipeline.c demo/interfaces/interface_registry.c -o test_pipeline
+
+#include <string.h>
+
+#include "test.h"
+#include "pipeline/pipeline.h"
+#include "classes/sequence_stage.h"
+#include "classes/increment_stage.h"
+#include "classes/check_stage.h"
+
+#define BLOCK_SIZE	64
+#define BLOCK_COUNT	4
+
+// many times the memory of the rings, so they wrap around
+#define LENGTH		100000
+
+static max_align_t ring_memory[BYTE_RING_MEMORY_SIZE(BLOCK_SIZE, BLOCK_COUNT) / sizeof(max_align_t)];
+
+static void test_ring(void)
+{
+	byte_ring ring;
+	CHECK(!byte_ring_initialize(&ring, ring_memory, 0, BLOCK_COUNT));
+	CHECK(byte_ring_initialize(&ring, ring_memory, BLOCK_SIZE, BLOCK_COUNT));
+	
+	byte_sink sink = COBJ_AS(byte_sink, byte_ring, &ring);
+	byte_source source = COBJ_AS(byte_source, byte_ring, &ring);
+	
+	size_t length;
+	CHECK(!byte_source_acquire(&source, &length));
+	CHECK(length == 0);
+	CHECK(!byte_sink_acquire(&sink, BLOCK_SIZE + 1));
+	
+	// the ring wraps around a few times, with a full and an empty ring each time
+	unsigned char next = 0;
+	for(int round = 0; round < 3; round++){
+		for(int i = 0; i < BLOCK_COUNT; i++){
+			unsigned char * data = byte_sink_acquire(&sink, BLOCK_SIZE);
+			CHECK(data);
+			if(!data){
+				return;
+			}
+			
+			memset(data, next++, BLOCK_SIZE);
+			byte_sink_commit(&sink, BLOCK_SIZE - i);
+		}
+		CHECK(!byte_sink_acquire(&sink, 1));
+		
+		// the first block is released in two parts, then it's free for the producer
+		next -= BLOCK_COUNT;
+		const unsigned char * data = byte_source_acquire(&source, &length);
+		CHECK(data && length == BLOCK_SIZE && data[0] == next);
+		
+		byte_source_commit(&source, 10);
+		CHECK(!byte_sink_acquire(&sink, 1));
+		
+		data = byte_source_acquire(&source, &length);
+		CHECK(data && length == BLOCK_SIZE - 10 && data[0] == next);
+		byte_source_commit(&source, length);
+		next++;
+		
+		unsigned char * refilled = byte_sink_acquire(&sink, BLOCK_SIZE);
+		CHECK(refilled);
+		
+		for(int i = 1; i < BLOCK_COUNT; i++){
+			data = byte_source_acquire(&source, &length);
+			CHECK(data && length == (size_t)(BLOCK_SIZE - i) && data[length - 1] == next);
+			byte_source_commit(&source, length);
+			next++;
+		}
+		CHECK(!byte_source_acquire(&source, &length));
+	}
+	
+	// more than a block is rejected
+	CHECK(byte_sink_acquire(&sink, BLOCK_SIZE));
+	byte_sink_commit(&sink, BLOCK_SIZE + 1);
+	CHECK(!byte_source_acquire(&source, &length));
+	
+	// closed, after the last block is read
+	byte_sink_acquire(&sink, 1);
+	byte_sink_commit(&sink, 1);
+	byte_sink_close(&sink);
+	CHECK(!byte_source_is_closed(&source));
+	
+	CHECK(byte_source_acquire(&source, &length) && length == 1);
+	byte_source_commit(&source, 1);
+	CHECK(byte_source_is_closed(&source));
+}
+
+// sequence_stage -> increment_stage (stages - 2 times) -> check_stage
+static void test_pipeline(size_t stage_count, bool threads)
+{
+	static pipeline_stage stages[3];
+	static pipeline_worker workers[3];
+	static byte_ring rings[2];
+	static max_align_t memory[PIPELINE_MEMORY_SIZE(3, BLOCK_SIZE, BLOCK_COUNT) / sizeof(max_align_t)];
+	
+	sequence_stage first;
+	increment_stage middle;
+	check_stage last;
+	check_stage_result result = { 0 };
+	
+	// the chunks don't fit the blocks, so some are read in parts
+	CHECK(sequence_stage_initialize(&first, LENGTH, 50));
+	CHECK(increment_stage_initialize(&middle, 30));
+	CHECK(check_stage_initialize(&last, (unsigned char)(stage_count - 2), &result));
+	
+	stages[0] = COBJ_AS(pipeline_stage, sequence_stage, &first);
+	stages[1] = COBJ_AS(pipeline_stage, increment_stage, &middle);
+	stages[stage_count - 1] = COBJ_AS(pipeline_stage, check_stage, &last);
+	
+	pipeline p = {
+		.stages = stages, .workers = workers, .stage_count = stage_count,
+		.rings = rings, .memory = memory, .block_size = BLOCK_SIZE, .block_count = BLOCK_COUNT,
+	};
+	CHECK(pipeline_initialize(&p));
+	
+	if(threads){
+		CHECK(pipeline_start(&p));
+		pipeline_join(&p);
+	}else{
+		pipeline_run(&p);
+	}
+	
+	CHECK(result.length == LENGTH);
+	CHECK(result.mismatches == 0);
+	CHECK(result.blocks >= LENGTH / BLOCK_SIZE);
+	
+	for(size_t i = 0; i < stage_count; i++){
+		CHECK(workers[i].done);
+	}
+	for(size_t i = 0; i + 1 < stage_count; i++){
+		byte_source source = COBJ_AS(byte_source, byte_ring, &rings[i]);
+		CHECK(byte_source_is_closed(&source));
+	}
+}
+
+int main(void)
+{
+	test_ring();
+	
+	test_pipeline(2, false);
+	test_pipeline(3, false);
+	test_pipeline(2, true);
+	test_pipeline(3, true);
+	
+	return TEST_RESULT();
+}
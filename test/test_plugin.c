@@ -0,0 +1,61 @@
+// gcc -std=gnu11 -Wall -Wextra -fPIC -shared -Isrc -Idemo -Itest test/plugin/plugin.c test/classes/plugin_value.c -o test_plugin.so
+// gcc -std=gnu11 -Wall -Wextra -rdynamic -DVALUE_V2 -Isrc -Idemo -Itest test/test_plugin.c test/interfaces/interface_registry.c src/cobj-plugin.c -o test_plugin -ldl
+// ./test_plugin ./test_plugin.so
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "cobj-plugin.h"
+#include "interfaces/value.h"
+#include "interfaces/label.h"
+#include "classes/plugin_value.h"
+
+int main(int argc, char * argv[])
+{
+	static cobj_plugin_library missing;
+	static cobj_plugin_library plugin;
+	
+	// libraries which fail to load are skipped
+	cobj_plugin_add_library(&plugin, argc > 1 ? argv[1] : "./test_plugin.so");
+	cobj_plugin_add_library(&missing, "./test_plugin_missing.so");
+	
+	CHECK(atomic_load(&plugin.state) == cobj_plugin_state_unloaded);
+	
+	const cobj_class_descriptor * class_descriptor = cobj_plugin_find_class("plugin_value");
+	CHECK(class_descriptor);
+	CHECK(atomic_load(&plugin.state) == cobj_plugin_state_loaded);
+	CHECK(atomic_load(&missing.state) == cobj_plugin_state_failed);
+	CHECK(!cobj_plugin_find_class("no_such_class"));
+	
+	if(!class_descriptor){
+		return TEST_RESULT();
+	}
+	
+	CHECK(strcmp(class_descriptor->class_name, "plugin_value") == 0);
+	CHECK(class_descriptor->object_size >= sizeof(cobj_object));
+	CHECK(class_descriptor->cold_size == 0);
+	
+	// the object is created by the descriptor, the class is unknown to the program
+	cobj_object * object = aligned_alloc(class_descriptor->object_alignment,
+		(class_descriptor->object_size + class_descriptor->object_alignment - 1) / class_descriptor->object_alignment * class_descriptor->object_alignment);
+	
+	plugin_value_parameters no_text = { .value = 1, .text = NULL };
+	CHECK(!class_descriptor->initialize(object, NULL, &no_text));
+	
+	plugin_value_parameters parameters = { .value = 42, .text = "plugin" };
+	CHECK(class_descriptor->initialize(object, NULL, &parameters));
+	
+	label label_reference;
+	CHECK(label_queryinterface(object, &label_reference));
+	CHECK(strcmp(label_text(&label_reference), "plugin") == 0);
+	
+	// the plugin has the mt of value without set, so it can't be used as value now
+	value value_reference;
+	CHECK(value_descriptor->methods_count == 2);
+	CHECK(!value_queryinterface(object, &value_reference));
+	
+	free(object);
+	
+	return TEST_RESULT();
+}
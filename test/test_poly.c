@@ -0,0 +1,84 @@
+// gcc -std=gnu11 -Wall -Wextra -Isrc -Idemo -Itest test/test_poly.c test/classes/plugin_value.c test/classes/ticker.c test/interfaces/interface_registry.c -o test_poly
+
+#include "test.h"
+#include "cobj-poly.h"
+#include "interfaces/value.h"
+#include "classes/plugin_value.h"
+#include "classes/ticker.h"
+
+static void sum_values(const value * reference, void * context)
+{
+	*(int *)context += value_get(reference);
+}
+
+int main(void)
+{
+	static cobj_poly_segment segments[2];
+	static _Alignas(plugin_value) unsigned char values[3 * sizeof(plugin_value)];
+	static _Alignas(ticker) unsigned char tickers[2 * sizeof(ticker)];
+	
+	cobj_poly_collection collection;
+	cobj_poly_initialize(&collection, segments, 2);
+	CHECK(cobj_poly_add_segment(&collection, ticker_descriptor, tickers, sizeof(tickers)));
+	CHECK(cobj_poly_add_segment(&collection, plugin_value_descriptor, values, sizeof(values)));
+	
+	CHECK(cobj_poly_insert(&collection, ticker_descriptor, NULL, NULL));
+	
+	plugin_value_parameters parameters = { .value = 1, .text = "one" };
+	cobj_object * first = cobj_poly_insert(&collection, plugin_value_descriptor, NULL, &parameters);
+	CHECK(first);
+	
+	// a failed initialize doesn't add the object
+	parameters.text = NULL;
+	CHECK(!cobj_poly_insert(&collection, plugin_value_descriptor, NULL, &parameters));
+	CHECK(cobj_poly_count(&collection) == 2);
+	
+	parameters = (plugin_value_parameters){ .value = 2, .text = "two" };
+	CHECK(cobj_poly_insert(&collection, plugin_value_descriptor, NULL, &parameters));
+	
+	// reserve and commit around the direct initialize
+	plugin_value * third = (plugin_value *)cobj_poly_reserve(&collection, plugin_value_descriptor);
+	CHECK(third && plugin_value_initialize(third, 4, "four"));
+	cobj_poly_commit(&collection, &third->object);
+	CHECK(cobj_poly_count(&collection) == 4);
+	
+	// the segment is full
+	CHECK(!cobj_poly_reserve(&collection, plugin_value_descriptor));
+	
+	// the ticker segment is skipped
+	int sum = 0;
+	COBJ_POLY_FOR_EACH(&collection, value, &sum_values, &sum);
+	CHECK(sum == 7);
+	
+	sum = 0;
+	COBJ_POLY_FOR_EACH_REFERENCE(&collection, value, reference) {
+		sum += value_get(&reference);
+	}
+	CHECK(sum == 7);
+	
+	// a break leaves the segment
+	int visited = 0;
+	COBJ_POLY_FOR_EACH_REFERENCE(&collection, value, reference) {
+		visited++;
+		break;
+	}
+	CHECK(visited == 1);
+	
+	// the last object is moved to the place of the erased one
+	CHECK(cobj_poly_erase(&collection, first));
+	value moved;
+	CHECK(value_queryinterface(first, &moved) && value_get(&moved) == 4);
+	CHECK(cobj_poly_count(&collection) == 3);
+	CHECK(!cobj_poly_erase(&collection, &third->object));
+	
+	cobj_poly_clear(&collection);
+	CHECK(cobj_poly_count(&collection) == 0);
+	
+	visited = 0;
+	COBJ_POLY_FOR_EACH_REFERENCE(&collection, value, reference) {
+		visited++;
+	}
+	CHECK(visited == 0);
+	
+	return TEST_RESULT();
+}
@@ -0,0 +1,106 @@
+// gcc -std=gnu11 -Wall -Wextra -DCOBJ_PROFILE_GENERATE -Isrc -Idemo -Itest test/test_profile.c test/classes/plugin_value.c test/classes/cold_value.c test/interfaces/interface_registry.c src/cobj-profile.c -o test_profile_generate
+// ./test_profile_generate
+// gcc -std=gnu11 -Wall -Wextra -include test_profile.h -Isrc -Idemo -Itest test/test_profile.c test/classes/plugin_value.c test/classes/cold_value.c test/interfaces/interface_registry.c -o test_profile
+// ./test_profile
+
+#include <string.h>
+
+#include "test.h"
+#include "interfaces/value.h"
+#include "interfaces/label.h"
+#include "classes/plugin_value.h"
+#include "classes/cold_value.h"
+
+// the profile is written to the working directory, where the second build includes it
+#define PROFILE_PATH	"test_profile.h"
+#define PROFILE_50_PATH	"test_profile_50.h"
+
+static plugin_value plugin_object;
+static cold_value cold_object;
+static cold_value_cold cold_object_cold;
+
+#ifdef COBJ_PROFILE_GENERATE
+
+// true, if the file has a line starting with prefix
+static bool has_line(const char * path, const char * prefix)
+{
+	FILE * file = fopen(path, "r");
+	char line[256];
+	bool found = false;
+	
+	while(file && !found && fgets(line, sizeof(line), file)){
+		found = strncmp(line, prefix, strlen(prefix)) == 0;
+	}
+	
+	if(file){
+		fclose(file);
+	}
+	return found;
+}
+
+int main(void)
+{
+	CHECK(plugin_value_initialize(&plugin_object, 1, "plugin"));
+	CHECK(cold_value_initialize(&cold_object, &cold_object_cold, 2, "cold"));
+	
+	value plugin_value_reference, cold_value_reference;
+	label plugin_label, cold_label;
+	CHECK(value_queryinterface(&plugin_object.object, &plugin_value_reference));
+	CHECK(value_queryinterface(&cold_object.object, &cold_value_reference));
+	CHECK(label_queryinterface(&plugin_object.object, &plugin_label));
+	CHECK(label_queryinterface(&cold_object.object, &cold_label));
+	
+	// get is called on plugin_value 95 times of 100, text on both classes equally
+	for(int i = 0; i < 100; i++){
+		value_get(i < 95 ? &plugin_value_reference : &cold_value_reference);
+		label_text(i & 1 ? &plugin_label : &cold_label);
+	}
+	
+	CHECK(cobj_profile_write(PROFILE_PATH, 90));
+	CHECK(has_line(PROFILE_PATH, "// value_get: plugin_value 95 of 100 calls"));
+	CHECK(has_line(PROFILE_PATH, "#define COBJ_PROFILE_value_get\t(plugin_value)"));
+	CHECK(has_line(PROFILE_PATH, "// label_text: "));
+	CHECK(!has_line(PROFILE_PATH, "#define COBJ_PROFILE_label_text"));
+	
+	// a lower threshold names a class for text too
+	CHECK(cobj_profile_write(PROFILE_50_PATH, 50));
+	CHECK(has_line(PROFILE_50_PATH, "#define COBJ_PROFILE_value_get\t(plugin_value)"));
+	CHECK(has_line(PROFILE_50_PATH, "#define COBJ_PROFILE_label_text"));
+	remove(PROFILE_50_PATH);
+	
+	return TEST_RESULT();
+}
+
+#else
+
+#ifndef COBJ_PROFILE_value_get
+#	error "build with -include test_profile.h, written by test_profile_generate"
+#endif
+
+int main(void)
+{
+	CHECK(plugin_value_initialize(&plugin_object, 1, "plugin"));
+	CHECK(cold_value_initialize(&cold_object, &cold_object_cold, 2, "cold"));
+	
+	value plugin_value_reference, cold_value_reference;
+	CHECK(value_queryinterface(&plugin_object.object, &plugin_value_reference));
+	CHECK(value_queryinterface(&cold_object.object, &cold_value_reference));
+	
+	// the profiled class takes the direct call, the other one the mt
+	CHECK(plugin_value_reference.mt->get == &plugin_value_value_get_thunk);
+	CHECK(cold_value_reference.mt->get != &plugin_value_value_get_thunk);
+	
+	CHECK(value_get(&plugin_value_reference) == 1);
+	CHECK(value_get(&cold_value_reference) == 2);
+	
+	// label_text is not profiled, so it's still implemented by the registry
+	label cold_label;
+	CHECK(label_queryinterface(&cold_object.object, &cold_label));
+	CHECK(strcmp(label_text(&cold_label), "cold") == 0);
+	
+	remove(PROFILE_PATH);
+	
+	return TEST_RESULT();
+}
+
+#endif
@@ -0,0 +1,123 @@
+// gcc -std=gnu11 -Wall -Wextra -Isrc -Idemo -Itest test/test_reactor.c test/classes/pipe_reader.c demo/classes/epoll_reactor.c demo/classes/eventfd_source.c demo/classes/timerfd_source.c demo/interfaces/interface_registry.c -o test_reactor
+
+#define _GNU_SOURCE
+
+#include "test.h"
+#include "classes/epoll_reactor.h"
+#include "classes/eventfd_source.h"
+#include "classes/timerfd_source.h"
+#include "classes/pipe_reader.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+static epoll_reactor reactor;
+static epoll_reactor_registration pipe_registration;
+
+static void on_count(void * context, uint64_t count)
+{
+	*(uint64_t *)context += count;
+}
+
+// removes the pipe, which is ready in the same batch
+static void on_remove_pipe(void * context, uint64_t count)
+{
+	on_count(context, count);
+	epoll_reactor_remove(&reactor, &pipe_registration);
+}
+
+int main(void)
+{
+	CHECK(epoll_reactor_initialize(&reactor));
+	
+	// the counts signaled before the reactor waits are summed
+	static eventfd_source wake;
+	static epoll_reactor_registration wake_registration;
+	uint64_t woken = 0;
+	event_source source;
+	
+	CHECK(eventfd_source_initialize(&wake, &on_count, &woken));
+	CHECK(event_source_queryinterface(&wake.object, &source));
+	epoll_reactor_add(&reactor, &wake_registration, &source);
+	
+	CHECK(epoll_reactor_run_once(&reactor, 0) == 0);
+	CHECK(eventfd_source_signal(&wake, 2) && eventfd_source_signal(&wake, 3));
+	CHECK(epoll_reactor_run_once(&reactor, 0) == 1);
+	CHECK(woken == 5);
+	
+	// a pipe is read until it hangs up, then it's removed
+	int fds[2];
+	static pipe_reader reader;
+	
+	CHECK(pipe2(fds, O_NONBLOCK | O_CLOEXEC) == 0);
+	CHECK(pipe_reader_initialize(&reader, fds[0]));
+	CHECK(event_source_queryinterface(&reader.object, &source));
+	epoll_reactor_add(&reactor, &pipe_registration, &source);
+	
+	CHECK(write(fds[1], "abc", 3) == 3);
+	CHECK(epoll_reactor_run_once(&reactor, 0) == 1);
+	
+	pipe_reader_impl * state = (pipe_reader_impl *)&reader;
+	CHECK(state->bytes == 3 && state->calls == 1);
+	
+	CHECK(write(fds[1], "de", 2) == 2);
+	close(fds[1]);
+	CHECK(epoll_reactor_run_once(&reactor, 0) == 1);
+	CHECK(state->bytes == 5 && state->calls == 2 && (state->events & event_hangup));
+	CHECK(!pipe_registration.registered);
+	
+	CHECK(epoll_reactor_run_once(&reactor, 0) == 0);
+	CHECK(state->calls == 2);
+	close(fds[0]);
+	
+	// a source removed by another one of the same batch is not called
+	CHECK(pipe2(fds, O_NONBLOCK | O_CLOEXEC) == 0);
+	CHECK(pipe_reader_initialize(&reader, fds[0]));
+	CHECK(event_source_queryinterface(&reader.object, &source));
+	epoll_reactor_add(&reactor, &pipe_registration, &source);
+	
+	static eventfd_source remover;
+	static epoll_reactor_registration remover_registration;
+	uint64_t removed = 0;
+	
+	CHECK(eventfd_source_initialize(&remover, &on_remove_pipe, &removed));
+	CHECK(event_source_queryinterface(&remover.object, &source));
+	epoll_reactor_add(&reactor, &remover_registration, &source);
+	
+	// epoll reports the sources in the order they got ready
+	CHECK(epoll_reactor_run_once(&reactor, 0) == 0);
+	CHECK(eventfd_source_signal(&remover, 1));
+	CHECK(write(fds[1], "x", 1) == 1);
+	
+	CHECK(epoll_reactor_run_once(&reactor, 0) == 2);
+	CHECK(removed == 1 && state->calls == 0);
+	
+	CHECK(epoll_reactor_run_once(&reactor, 0) == 0);
+	CHECK(state->calls == 0);
+	
+	epoll_reactor_remove(&reactor, &remover_registration);
+	eventfd_source_close(&remover);
+	close(fds[0]);
+	close(fds[1]);
+	
+	// a timer reports it's expirations
+	static timerfd_source timer;
+	static epoll_reactor_registration timer_registration;
+	uint64_t expirations = 0;
+	
+	CHECK(timerfd_source_initialize(&timer, 1000000, &on_count, &expirations));
+	CHECK(event_source_queryinterface(&timer.object, &source));
+	epoll_reactor_add(&reactor, &timer_registration, &source);
+	
+	CHECK(epoll_reactor_run_once(&reactor, 1000) == 1);
+	CHECK(expirations >= 1);
+	
+	epoll_reactor_remove(&reactor, &timer_registration);
+	timerfd_source_close(&timer);
+	
+	epoll_reactor_remove(&reactor, &wake_registration);
+	eventfd_source_close(&wake);
+	epoll_reactor_close(&reactor);
+	
+	return TEST_RESULT();
+}
@@ -0,0 +1,122 @@
+// gcc -std=gnu11 -Wall -Wextra -DVALUE_V2 -Isrc -Idemo -Itest test/test_record.c test/classes/plugin_value.c test/interfaces/interface_registry.c test/interfaces/interface_record.c src/cobj-record.c -o test_record
+
+#include <string.h>
+#include <stdint.h>
+
+#include "test.h"
+#include "cobj-record.h"
+#include "interfaces/value.h"
+#include "classes/plugin_value.h"
+
+#define CALLS	1000
+
+// the records of set and get, as generated in interface_record.c
+typedef struct {
+	cobj_record_header record_header;
+	int value;
+} set_record;
+
+typedef struct {
+	cobj_record_header record_header;
+} get_record;
+
+// the file is recorded to the working directory
+#define RECORD_PATH	"test_record.rec"
+
+// reads the file into buffer, returns the size
+static size_t read_file(const char * path, unsigned char * buffer, size_t size)
+{
+	FILE * file = fopen(path, "rb");
+	if(!file){
+		return 0;
+	}
+	
+	size = fread(buffer, 1, size, file);
+	fclose(file);
+	return size;
+}
+
+static void write_file(const char * path, const unsigned char * buffer, size_t size)
+{
+	FILE * file = fopen(path, "wb");
+	if(file){
+		fwrite(buffer, 1, size, file);
+		fclose(file);
+	}
+}
+
+int main(void)
+{
+	// record calls to a plugin_value
+	plugin_value recorded_object;
+	CHECK(plugin_value_initialize(&recorded_object, 0, "recorded"));
+	
+	value recorded_value;
+	CHECK(value_queryinterface(&recorded_object.object, &recorded_value));
+	
+	cobj_record_writer writer;
+	CHECK(cobj_record_open(&writer, RECORD_PATH, "value"));
+	
+	value_recorder recorder;
+	CHECK(value_recorder_initialize(&recorder, &recorded_value, &writer));
+	
+	value recorder_value;
+	CHECK(value_queryinterface(&recorder.object, &recorder_value));
+	
+	for(int i = 1; i <= CALLS; ++i){
+		value_set(&recorder_value, i);
+		CHECK(value_get(&recorder_value) == i);
+	}
+	
+	cobj_record_close(&writer);
+	
+	// the padding of the records is zero, no memory of the recording process is written
+	static unsigned char file[sizeof(cobj_record_file_header) + 2 * CALLS * 64];
+	size_t file_size = read_file(RECORD_PATH, file, sizeof(file));
+	
+	CHECK(file_size == sizeof(cobj_record_file_header) + CALLS * (sizeof(set_record) + sizeof(get_record)));
+	
+	const set_record * first_record = (const set_record *)(file + sizeof(cobj_record_file_header));
+	const unsigned char * padding = (const unsigned char *)&first_record->value + sizeof(first_record->value);
+	
+	CHECK(first_record->value == 1);
+	CHECK(padding < (const unsigned char *)(first_record + 1));
+	
+	for(const unsigned char * byte = padding; byte < (const unsigned char *)(first_record + 1); ++byte){
+		CHECK(*byte == 0);
+	}
+	
+	// the replay to another object makes the same calls
+	plugin_value replayed_object;
+	CHECK(plugin_value_initialize(&replayed_object, -1, "replayed"));
+	
+	value replayed_value;
+	CHECK(value_queryinterface(&replayed_object.object, &replayed_value));
+	
+	cobj_record_stats stats;
+	CHECK(value_replay(RECORD_PATH, &replayed_value, false, &stats));
+	CHECK(stats.calls == 2 * CALLS);
+	CHECK(value_get(&replayed_value) == CALLS);
+	CHECK(cobj_record_stats_percentile(&stats, 1.0) >= stats.max / 2);
+	
+	// paced, the replay takes at least the time of the recording
+	const cobj_record_header * last_record = (const cobj_record_header *)(file + file_size - sizeof(get_record));
+	CHECK(value_replay(RECORD_PATH, &replayed_value, true, &stats));
+	CHECK(stats.elapsed >= last_record->time);
+	
+	// a truncated file fails, after replaying the complete records
+	write_file(RECORD_PATH, file, file_size - 1);
+	CHECK(!value_replay(RECORD_PATH, &replayed_value, false, &stats));
+	CHECK(stats.calls == 2 * CALLS - 1);
+	
+	// a file of another interface fails
+	cobj_record_file_header * header = (cobj_record_file_header *)file;
+	strcpy(header->interface_name, "label");
+	write_file(RECORD_PATH, file, file_size);
+	CHECK(!value_replay(RECORD_PATH, &replayed_value, false, &stats));
+	CHECK(stats.calls == 0);
+	
+	remove(RECORD_PATH);
+	
+	return TEST_RESULT();
+}
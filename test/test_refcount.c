@@ -0,0 +1,208 @@
+// gcc -std=gnu11 -Wall -Wextra -pthread -DCOBJ_REFCOUNT_THREADS=2 -Isrc -Idemo -Itest test/test_refcount.c test/classes/refcounted_value.c test/interfaces/interface_registry.c src/cobj-refcount.c -o test_refcount
+
+#include <pthread.h>
+
+#include "test.h"
+#include "cobj-refcount.h"
+#include "classes/refcounted_value.h"
+
+// the pool has two queues (COBJ_REFCOUNT_THREADS is defined by the build command): the main thread
+// takes one, the threads of the test share the other one
+COBJPVT_ASSERT(COBJ_REFCOUNT_THREADS == 2, "build with -DCOBJ_REFCOUNT_THREADS=2");
+
+static intptr_t shared_flags(const cobj_refcount * refcount)
+{
+	return atomic_load(&refcount->shared) & (COBJ_REFCOUNT_ONE - 1);
+}
+
+// the flags are never negative, so they are removed before the division
+static intptr_t shared_count(const cobj_refcount * refcount)
+{
+	return (atomic_load(&refcount->shared) - shared_flags(refcount)) / COBJ_REFCOUNT_ONE;
+}
+
+static void * release_thread(void * object)
+{
+	cobj_release(object);
+	return NULL;
+}
+
+static void run(void * (*function)(void *), void * context)
+{
+	pthread_t thread;
+	CHECK(pthread_create(&thread, NULL, function, context) == 0);
+	pthread_join(thread, NULL);
+}
+
+// the owner exits, and hands out a reference to the main thread
+typedef struct {
+	refcounted_value object;
+	atomic_int finalized;
+	cobj_refcount_queue * owner;
+} handover;
+
+static void * handover_thread(void * context)
+{
+	handover * state = context;
+	CHECK(refcounted_value_initialize(&state->object, 3, &state->finalized));
+	state->owner = cobj_refcount_current;
+	
+	// the reference of the main thread, and the own one is released
+	cobj_retain(&state->object.object);
+	cobj_release(&state->object.object);
+	return NULL;
+}
+
+// the next thread takes the queue of the exited owner, and merges the objects queued to it
+static void * takeover_thread(void * context)
+{
+	handover * state = context;
+	CHECK(atomic_load(&state->finalized) == 0);
+	
+	static refcounted_value object;
+	static atomic_int finalized;
+	CHECK(refcounted_value_initialize(&object, 4, &finalized));
+	
+	CHECK(cobj_refcount_current == state->owner);
+	CHECK(atomic_load(&state->finalized) == 1);
+	
+	cobj_release(&object.object);
+	CHECK(atomic_load(&finalized) == 1);
+	return NULL;
+}
+
+// holds the second queue, until the main thread checks the fallback
+static pthread_barrier_t holding;
+
+static void * holding_thread(void * context)
+{
+	atomic_int * finalized = context;
+	
+	refcounted_value object;
+	CHECK(refcounted_value_initialize(&object, 5, finalized));
+	CHECK(!cobj_refcount_of(&object.object)->merged);
+	
+	pthread_barrier_wait(&holding);
+	pthread_barrier_wait(&holding);
+	
+	cobj_release(&object.object);
+	return NULL;
+}
+
+static void * unowned_thread(void * context)
+{
+	atomic_int * finalized = context;
+	
+	refcounted_value object;
+	CHECK(refcounted_value_initialize(&object, 6, finalized));
+	
+	// the pool is empty, so the object is merged: all counts are shared
+	cobj_refcount * refcount = cobj_refcount_of(&object.object);
+	CHECK(cobj_refcount_current == NULL);
+	CHECK(refcount->merged);
+	CHECK(shared_count(refcount) == 1);
+	CHECK(shared_flags(refcount) == COBJ_REFCOUNT_MERGED);
+	
+	cobj_retain(&object.object);
+	CHECK(shared_count(refcount) == 2);
+	
+	cobj_release(&object.object);
+	CHECK(atomic_load(finalized) == 0);
+	
+	cobj_release(&object.object);
+	CHECK(atomic_load(finalized) == 1);
+	return NULL;
+}
+
+int main(void)
+{
+	// the owner changes the biased count only
+	static refcounted_value owned;
+	static atomic_int owned_finalized;
+	CHECK(refcounted_value_initialize(&owned, 1, &owned_finalized));
+	
+	cobj_refcount * refcount = cobj_refcount_of(&owned.object);
+	CHECK(refcount->owner == cobj_refcount_current);
+	CHECK(refcount->biased == 1);
+	
+	cobj_retain(&owned.object);
+	cobj_retain(&owned.object);
+	CHECK(refcount->biased == 3);
+	cobj_release(&owned.object);
+	CHECK(refcount->biased == 2);
+	CHECK(atomic_load(&refcount->shared) == 0);
+	
+	// another thread releases the reference it got from the owner: the shared count gets negative,
+	// and the object is queued to the owner, until it flushes
+	run(&release_thread, &owned.object);
+	CHECK(shared_count(refcount) == -1);
+	CHECK(shared_flags(refcount) == COBJ_REFCOUNT_QUEUED);
+	CHECK(atomic_load(&cobj_refcount_current->head) == refcount);
+	CHECK(refcount->biased == 2);
+	
+	cobj_refcount_flush();
+	CHECK(atomic_load(&cobj_refcount_current->head) == NULL);
+	CHECK(refcount->merged);
+	CHECK(shared_count(refcount) == 1);
+	CHECK(shared_flags(refcount) == COBJ_REFCOUNT_MERGED);
+	CHECK(atomic_load(&owned_finalized) == 0);
+	
+	// merged, the owner releases by the shared count. The last reference finalizes the object once.
+	cobj_release(&owned.object);
+	CHECK(atomic_load(&owned_finalized) == 1);
+	cobj_refcount_flush();
+	CHECK(atomic_load(&owned_finalized) == 1);
+	
+	// the biased count drops to 0, while another thread holds a reference: the counts are merged,
+	// and the other thread finalizes it
+	static refcounted_value passed;
+	static atomic_int passed_finalized;
+	CHECK(refcounted_value_initialize(&passed, 2, &passed_finalized));
+	
+	cobj_retain(&passed.object);
+	cobj_release(&passed.object);
+	CHECK(atomic_load(&passed_finalized) == 0);
+	
+	refcount = cobj_refcount_of(&passed.object);
+	cobj_refcount_retain_shared(refcount);
+	cobj_release(&passed.object);
+	CHECK(refcount->merged);
+	CHECK(atomic_load(&passed_finalized) == 0);
+	
+	run(&release_thread, &passed.object);
+	CHECK(atomic_load(&passed_finalized) == 1);
+	
+	// the owner exits, the reference of the main thread is queued to it's queue, and merged by the
+	// next thread taking the queue
+	static handover state;
+	run(&handover_thread, &state);
+	CHECK(state.owner != NULL);
+	CHECK(state.owner != cobj_refcount_current);
+	CHECK(!atomic_load(&state.owner->used));
+	
+	cobj_release(&state.object.object);
+	CHECK(atomic_load(&state.owner->head) == cobj_refcount_of(&state.object.object));
+	CHECK(atomic_load(&state.finalized) == 0);
+	
+	run(&takeover_thread, &state);
+	
+	// while the pool is empty, the objects are initialized merged
+	static atomic_int held_finalized;
+	static atomic_int unowned_finalized;
+	
+	pthread_barrier_init(&holding, NULL, 2);
+	pthread_t holder;
+	CHECK(pthread_create(&holder, NULL, &holding_thread, &held_finalized) == 0);
+	pthread_barrier_wait(&holding);
+	
+	run(&unowned_thread, &unowned_finalized);
+	
+	pthread_barrier_wait(&holding);
+	pthread_join(holder, NULL);
+	pthread_barrier_destroy(&holding);
+	
+	CHECK(atomic_load(&held_finalized) == 1);
+	CHECK(atomic_load(&unowned_finalized) == 1);
+	
+	return TEST_RESULT();
+}
@@ -0,0 +1,36 @@
+// gcc -std=gnu11 -Wall -Wextra -DVALUE_V2 -Isrc -Idemo -Itest test/test_reflect.c test/classes/plugin_value.c test/interfaces/interface_registry.c src/cobj.c -o test_reflect
+
+#include "test.h"
+#include "interfaces/value.h"
+#include "classes/plugin_value.h"
+
+int main(void)
+{
+	plugin_value object;
+	CHECK(plugin_value_initialize(&object, 3, "reflect"));
+	
+	value reference;
+	CHECK(value_queryinterface(&object.object, &reference));
+	
+	const cobj_method_descriptor * get = cobj_interface_find_method(value_descriptor, "get");
+	const cobj_method_descriptor * set = cobj_interface_find_method(value_descriptor, "set");
+	CHECK(get && set);
+	CHECK(!cobj_interface_find_method(value_descriptor, "reset"));
+	
+	CHECK(get->index == value_get_method_index && get->return_size == sizeof(int));
+	CHECK(set->arguments_count == 1 && set->arguments[0].size == sizeof(int));
+	
+	// the arguments are packed, the result is copied
+	value_set_arguments arguments = { .value = 42 };
+	cobj_invoke(set, &reference, &arguments, NULL);
+	CHECK(value_get(&reference) == 42);
+	
+	int result = 0;
+	cobj_invoke(get, &reference, NULL, &result);
+	CHECK(result == 42);
+	
+	// without a result pointer, the result is dropped
+	cobj_invoke(get, &reference, NULL, NULL);
+	
+	return TEST_RESULT();
+}
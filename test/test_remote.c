@@ -0,0 +1,101 @@
+// gcc -std=gnu11 -Wall -Wextra -DVALUE_V2 -Isrc -Idemo -Itest test/test_remote.c test/classes/plugin_value.c test/interfaces/interface_registry.c test/interfaces/interface_remote.c src/cobj-remote.c -o test_remote -lpthread
+
+#include <pthread.h>
+#include <time.h>
+
+#include "test.h"
+#include "cobj-remote.h"
+#include "interfaces/value.h"
+#include "classes/plugin_value.h"
+
+#define CALLS	100000
+
+// the rings are large, so the channels are not on the stack
+static cobj_remote_channel channel;
+static cobj_remote_channel unserved_channel;
+
+static void * server_thread(void * argument)
+{
+	plugin_value object;
+	plugin_value_initialize(&object, 0, "server");
+	
+	value value_reference;
+	value_queryinterface(&object.object, &value_reference);
+	
+	value_stub_serve(argument, &value_reference);
+	return NULL;
+}
+
+static double elapsed_ms(const struct timespec * start)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+int main(void)
+{
+	// calls to a server thread
+	cobj_remote_channel_initialize(&channel);
+	
+	pthread_t server;
+	CHECK(pthread_create(&server, NULL, &server_thread, &channel) == 0);
+	
+	value_proxy proxy;
+	value_proxy_initialize(&proxy, &channel);
+	
+	value remote_value;
+	CHECK(value_queryinterface(&proxy.object, &remote_value));
+	
+	// the sets are pipelined, the get waits until they are executed
+	for(int i = 1; i <= CALLS; ++i){
+		value_set(&remote_value, i);
+	}
+	
+	CHECK(value_get(&remote_value) == CALLS);
+	CHECK(cobj_remote_channel_status(&channel) == cobj_remote_status_ok);
+	
+	// a method the stub doesn't know is answered with an error, and the channel fails
+	CHECK(cobj_remote_request(&channel, 77, sizeof(cobj_remote_header)));
+	CHECK(!cobj_remote_call(&channel, 77));
+	CHECK(cobj_remote_channel_status(&channel) == cobj_remote_status_unknown_method);
+	CHECK(value_get(&remote_value) == 0);
+	
+	cobj_remote_close(&channel);
+	CHECK(pthread_join(server, NULL) == 0);
+	
+	// without a server, the calls time out
+	cobj_remote_channel_initialize(&unserved_channel);
+	unserved_channel.timeout_ms = 50;
+	value_proxy_initialize(&proxy, &unserved_channel);
+	CHECK(value_queryinterface(&proxy.object, &remote_value));
+	
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	
+	// the sets don't wait, until the request ring is full
+	int sets = 0;
+	while(cobj_remote_channel_status(&unserved_channel) == cobj_remote_status_ok && sets < CALLS){
+		value_set(&remote_value, ++sets);
+	}
+	
+	CHECK(sets < CALLS);
+	CHECK(cobj_remote_channel_status(&unserved_channel) == cobj_remote_status_timeout);
+	CHECK(elapsed_ms(&start) >= 50);
+	
+	// the channel stays failed, so the next call doesn't wait again
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	CHECK(value_get(&remote_value) == 0);
+	CHECK(elapsed_ms(&start) < 50);
+	
+	// a call with a result times out waiting for the reply
+	cobj_remote_channel_initialize(&unserved_channel);
+	unserved_channel.timeout_ms = 50;
+	
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	CHECK(value_get(&remote_value) == 0);
+	CHECK(elapsed_ms(&start) >= 50);
+	CHECK(cobj_remote_channel_status(&unserved_channel) == cobj_remote_status_timeout);
+	
+	return TEST_RESULT();
+}
@@ -0,0 +1,97 @@
+// gcc -std=gnu11 -Wall -Wextra -DVALUE_V2 -Isrc -Idemo -Itest test/test_shared.c test/classes/plugin_value.c test/classes/counted_grid.c test/interfaces/interface_registry.c src/cobj-shared.c -o test_shared
+
+#define _GNU_SOURCE
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "test.h"
+#include "cobj-shared.h"
+#include "interfaces/value.h"
+#include "classes/plugin_value.h"
+#include "classes/counted_grid.h"
+
+// the graph in the segment, the objects reference each other
+typedef struct graph {
+	plugin_value first;
+	plugin_value second;
+	value_shared first_to_second;
+	value_shared second_to_first;
+	value_shared none;
+} graph;
+
+int main(void)
+{
+	// the segment is mapped twice, like by two processes
+	int segment = memfd_create("test_shared", 0);
+	CHECK(segment >= 0);
+	CHECK(ftruncate(segment, sizeof(graph)) == 0);
+	
+	graph * created = mmap(NULL, sizeof(graph), PROT_READ | PROT_WRITE, MAP_SHARED, segment, 0);
+	graph * mapped = mmap(NULL, sizeof(graph), PROT_READ | PROT_WRITE, MAP_SHARED, segment, 0);
+	CHECK(created != MAP_FAILED && mapped != MAP_FAILED);
+	CHECK(created != mapped);
+	if(created == MAP_FAILED || mapped == MAP_FAILED){
+		return TEST_RESULT();
+	}
+	
+	CHECK(cobj_shared_register(plugin_value_descriptor));
+	CHECK(cobj_shared_register(plugin_value_descriptor));
+	CHECK(cobj_shared_class_id("plugin_value") == cobj_shared_class_id("plugin_value"));
+	CHECK(cobj_shared_class_id("plugin_value") != cobj_shared_class_id("counted_grid"));
+	
+	// the process creating the graph
+	CHECK(plugin_value_initialize(&created->first, 1, "first"));
+	CHECK(plugin_value_initialize(&created->second, 2, "second"));
+	CHECK(cobj_shared_publish(&created->first.object));
+	CHECK(cobj_shared_publish(&created->second.object));
+	CHECK(cobj_shared_publish(&created->second.object));
+	
+	value_shared_set(&created->first_to_second, &created->second.object);
+	value_shared_set(&created->second_to_first, &created->first.object);
+	value_shared_set(&created->none, NULL);
+	
+	// the class_descriptor of a published object is the id, resolved by the registered classes
+	CHECK(mapped->first.object.class_descriptor != plugin_value_descriptor);
+	CHECK(cobj_shared_class(&mapped->first.object) == plugin_value_descriptor);
+	CHECK(cobj_shared_queryinterface(&mapped->first.object, value_descriptor));
+	
+	// the references stored by one mapping resolve to the objects of the other mapping
+	value second;
+	CHECK(value_resolve(&mapped->first_to_second, &second));
+	CHECK(second.object == &mapped->second.object);
+	CHECK(value_get(&second) == 2);
+	
+	value first;
+	CHECK(value_resolve(&mapped->second_to_first, &first));
+	CHECK(first.object == &mapped->first.object);
+	CHECK(value_get(&first) == 1);
+	
+	value null_reference;
+	CHECK(!value_resolve(&mapped->none, &null_reference));
+	
+	// a call through one mapping is seen through the other one
+	value_set(&second, 20);
+	
+	value created_second;
+	CHECK(value_resolve(&created->first_to_second, &created_second));
+	CHECK(created_second.object == &created->second.object);
+	CHECK(value_get(&created_second) == 20);
+	
+	// ordinary objects are resolved too, objects of unregistered classes are not published
+	plugin_value ordinary;
+	CHECK(plugin_value_initialize(&ordinary, 3, "ordinary"));
+	CHECK(cobj_shared_class(&ordinary.object) == plugin_value_descriptor);
+	
+	counted_grid_calls calls = { 0 };
+	counted_grid unregistered;
+	CHECK(counted_grid_initialize(&unregistered, &calls));
+	CHECK(!cobj_shared_publish(&unregistered.object));
+	CHECK(unregistered.object.class_descriptor == counted_grid_descriptor);
+	
+	munmap(created, sizeof(graph));
+	munmap(mapped, sizeof(graph));
+	close(segment);
+	
+	return TEST_RESULT();
+}
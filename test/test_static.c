@@ -0,0 +1,57 @@
+// gcc -std=gnu11 -Wall -Wextra -Isrc -Idemo -Itest test/test_static.c test/classes/plugin_value.c test/classes/counted_grid.c test/interfaces/interface_registry.c -o test_static
+// gcc -std=gnu11 -fsyntax-only -DTEST_AS_UNIMPLEMENTED -Isrc -Idemo -Itest test/test_static.c	(fails to compile)
+
+#include <string.h>
+
+#include "test.h"
+#include "interfaces/value.h"
+#include "interfaces/label.h"
+#include "classes/plugin_value.h"
+#include "classes/counted_grid.h"
+
+// wired at compile time, and placed into read-only memory
+static const COBJ_STATIC_OBJECT(plugin_value, static_object, .value = 7, .text = "static");
+static const value static_value = COBJ_STATIC_REFERENCE(value, plugin_value, static_object);
+static const label static_label = COBJ_STATIC_REFERENCE(label, plugin_value, static_object);
+
+int main(void)
+{
+	// the static object is like an initialized one
+	CHECK(static_object.object.class_descriptor == plugin_value_descriptor);
+	CHECK(static_value.object == &static_object.object);
+	CHECK(value_get(&static_value) == 7);
+	CHECK(strcmp(label_text(&static_label), "static") == 0);
+	
+	value queried_value;
+	label queried_label;
+	CHECK(value_queryinterface((cobj_object *)&static_object.object, &queried_value));
+	CHECK(label_queryinterface((cobj_object *)&static_object.object, &queried_label));
+	CHECK(queried_value.mt == static_value.mt);
+	CHECK(queried_label.mt == static_label.mt);
+	
+	// the accessors of the class return the same references as queryinterface
+	plugin_value object;
+	CHECK(plugin_value_initialize(&object, 3, "object"));
+	CHECK(value_queryinterface(&object.object, &queried_value));
+	
+	value as_value = plugin_value_as_value(&object);
+	CHECK(as_value.mt == queried_value.mt && as_value.object == queried_value.object);
+	CHECK(as_value.mt == static_value.mt);
+	CHECK(value_get(&as_value) == 3);
+	
+	label as_label = COBJ_AS(label, plugin_value, &object);
+	CHECK(label_queryinterface(&object.object, &queried_label));
+	CHECK(as_label.mt == queried_label.mt && as_label.object == &object.object);
+	CHECK(strcmp(label_text(&as_label), "object") == 0);
+	
+	// the class is known, so the reference of an interface it doesn't implement isn't compiled
+	counted_grid_calls calls = { 0 };
+	counted_grid grid_object;
+	CHECK(counted_grid_initialize(&grid_object, &calls));
+	CHECK(!value_queryinterface(&grid_object.object, &queried_value));
+#ifdef TEST_AS_UNIMPLEMENTED
+	queried_value = COBJ_AS(value, counted_grid, &grid_object);
+#endif
+	
+	return TEST_RESULT();
+}
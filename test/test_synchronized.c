@@ -0,0 +1,154 @@
+// gcc -std=gnu11 -Wall -Wextra -pthread -Isrc -Idemo -Itest test/test_synchronized.c test/classes/counted_pin.c demo/interfaces/interface_registry.c demo/interfaces/interface_synchronized.c src/cobj-synchronized.c -o test_synchronized
+
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "test.h"
+#include "cobj-synchronized.h"
+#include "classes/counted_pin.h"
+
+#define THREADS	4
+#define CALLS	200
+
+static void sleep_ms(long ms)
+{
+	struct timespec delay = { .tv_sec = 0, .tv_nsec = ms * 1000000 };
+	nanosleep(&delay, NULL);
+}
+
+typedef struct {
+	gpio_pin * pin;
+	pthread_barrier_t * start;
+} caller;
+
+static void * write_thread(void * context)
+{
+	caller * state = context;
+	pthread_barrier_wait(state->start);
+	
+	for(int i = 0; i < CALLS; ++i){
+		gpio_pin_toggle(state->pin);
+		gpio_pin_set_options(state->pin, gpio_pin_options_pullup);
+	}
+	return NULL;
+}
+
+static void * read_thread(void * context)
+{
+	caller * state = context;
+	pthread_barrier_wait(state->start);
+	
+	gpio_pin_get_value(state->pin);
+	return NULL;
+}
+
+static void * set_thread(void * pin)
+{
+	gpio_pin_set_value(pin, true);
+	return NULL;
+}
+
+static void * get_thread(void * pin)
+{
+	gpio_pin_get_value(pin);
+	return NULL;
+}
+
+// starts function on THREADS threads at the same time
+static void run_together(void * (*function)(void *), gpio_pin * pins[THREADS])
+{
+	pthread_barrier_t start;
+	pthread_barrier_init(&start, NULL, THREADS);
+	
+	pthread_t threads[THREADS];
+	caller callers[THREADS];
+	
+	for(int i = 0; i < THREADS; ++i){
+		callers[i].pin = pins[i];
+		callers[i].start = &start;
+		CHECK(pthread_create(&threads[i], NULL, function, &callers[i]) == 0);
+	}
+	
+	for(int i = 0; i < THREADS; ++i){
+		pthread_join(threads[i], NULL);
+	}
+	
+	pthread_barrier_destroy(&start);
+}
+
+int main(void)
+{
+	static counted_pin_calls calls;
+	counted_pin object;
+	CHECK(counted_pin_initialize(&object, &calls));
+	
+	gpio_pin target;
+	CHECK(gpio_pin_queryinterface(&object.object, &target));
+	
+	static cobj_rwlock lock = COBJ_RWLOCK_INITIALIZER;
+	COBJ_SYNCHRONIZED(gpio_pin) synchronized_pin;
+	CHECK(gpio_pin_synchronized_initialize(&synchronized_pin, &target, &lock));
+	
+	gpio_pin pin;
+	CHECK(gpio_pin_queryinterface(&synchronized_pin.object, &pin));
+	gpio_pin * pins[THREADS] = { &pin, &pin, &pin, &pin };
+	
+	// the writers hold the lock alone
+	calls.delay_ns = 10000;
+	run_together(&write_thread, pins);
+	CHECK(atomic_load(&calls.toggle) == THREADS * CALLS);
+	CHECK(atomic_load(&calls.set_options) == THREADS * CALLS);
+	CHECK(atomic_load(&calls.overlaps) == 0);
+	CHECK(atomic_load(&lock.state) == 0);
+	
+	// the pure methods share it
+	memset(&calls, 0, sizeof(calls));
+	calls.delay_ns = 50000000;
+	run_together(&read_thread, pins);
+	CHECK(atomic_load(&calls.get_value) == THREADS);
+	CHECK(atomic_load(&calls.max_readers) > 1);
+	CHECK(atomic_load(&calls.overlaps) == 0);
+	CHECK(atomic_load(&lock.state) == 0);
+	
+	// a waiting writer blocks new readers: the reader enters after the writer
+	memset(&calls, 0, sizeof(calls));
+	cobj_rwlock_read_lock(&lock);
+	
+	pthread_t writer;
+	CHECK(pthread_create(&writer, NULL, &set_thread, &pin) == 0);
+	while(!(atomic_load(&lock.state) & COBJ_RWLOCK_WAITING)){
+		sleep_ms(1);
+	}
+	
+	pthread_t reader;
+	CHECK(pthread_create(&reader, NULL, &get_thread, &pin) == 0);
+	sleep_ms(20);
+	CHECK(atomic_load(&calls.order_length) == 0);
+	
+	cobj_rwlock_read_unlock(&lock);
+	pthread_join(writer, NULL);
+	pthread_join(reader, NULL);
+	CHECK(strcmp(calls.order, "vg") == 0);
+	CHECK(atomic_load(&lock.state) == 0);
+	
+	// the stripe is selected by the object, so all decorators of the object exclude each other
+	CHECK(cobj_rwlock_stripe(target.object) == cobj_rwlock_stripe(target.object));
+	
+	COBJ_SYNCHRONIZED(gpio_pin) striped_pins[2];
+	gpio_pin striped[2];
+	
+	for(int i = 0; i < 2; ++i){
+		CHECK(gpio_pin_synchronized_initialize(&striped_pins[i], &target, cobj_rwlock_stripe(target.object)));
+		CHECK(gpio_pin_queryinterface(&striped_pins[i].object, &striped[i]));
+	}
+	
+	memset(&calls, 0, sizeof(calls));
+	calls.delay_ns = 10000;
+	gpio_pin * striped_callers[THREADS] = { &striped[0], &striped[1], &striped[0], &striped[1] };
+	run_together(&write_thread, striped_callers);
+	CHECK(atomic_load(&calls.toggle) == THREADS * CALLS);
+	CHECK(atomic_load(&calls.overlaps) == 0);
+	
+	return TEST_RESULT();
+}
@@ -0,0 +1,119 @@
+// gcc -std=gnu11 -O2 -Wall -Wextra -Isrc -Idemo -Itest test/test_wheel.c demo/classes/timing_wheel.c demo/interfaces/interface_registry.c -o test_wheel
+
+#include "test.h"
+#include "classes/timing_wheel.h"
+
+#include <stdlib.h>
+
+// a million timers, one in ten of them up to 40M ticks ahead
+#define TIMERS	1000000
+
+static timing_wheel wheel;
+static scheduler wheel_scheduler;
+static timing_wheel_node nodes[TIMERS + 8];
+
+static uint64_t due[TIMERS];
+static long fired;
+static long late;
+
+// checks the timer expires at the time it was scheduled for
+static void on_due(void * context)
+{
+	fired++;
+	
+	if(*(uint64_t *)context != scheduler_now(&wheel_scheduler)){
+		late++;
+	}
+}
+
+static int every_count;
+static scheduler_timer every_timer;
+
+static void on_every(void * context)
+{
+	(void)context;
+	
+	if(++every_count == 3){
+		CHECK(scheduler_cancel(&wheel_scheduler, every_timer));
+	}
+}
+
+static scheduler_timer victim_timer;
+static int victim_count;
+
+static void on_victim(void * context)
+{
+	(void)context;
+	victim_count++;
+}
+
+// cancels a timer of the same slot, and schedules one in the past
+static void on_killer(void * context)
+{
+	(void)context;
+	CHECK(scheduler_cancel(&wheel_scheduler, victim_timer));
+	CHECK(scheduler_schedule_at(&wheel_scheduler, 0, &on_victim, NULL));
+}
+
+// the only timer advances the wheel, while it's not in a slot
+static void on_advance(void * context)
+{
+	timing_wheel_advance(&wheel, *(uint64_t *)context);
+}
+
+int main(void)
+{
+	CHECK(timing_wheel_initialize(&wheel, nodes, TIMERS + 8));
+	CHECK(scheduler_queryinterface(&wheel.object, &wheel_scheduler));
+	
+	srand(1);
+	for(long i = 0; i < TIMERS; i++){
+		uint64_t random = ((uint64_t)rand() << 8 ^ (uint64_t)rand()) % (i % 10 == 0 ? 40000000u : 300000u);
+		due[i] = random + 1;
+		
+		if(!scheduler_schedule_at(&wheel_scheduler, due[i], &on_due, &due[i])){
+			CHECK(!"scheduled");
+			break;
+		}
+	}
+	
+	CHECK(timing_wheel_pending(&wheel) == TIMERS);
+	timing_wheel_advance(&wheel, 40000001u);
+	CHECK(fired == TIMERS && late == 0 && timing_wheel_pending(&wheel) == 0);
+	
+	// a periodic timer cancelled by itself
+	every_timer = scheduler_schedule_every(&wheel_scheduler, 10, &on_every, NULL);
+	timing_wheel_advance(&wheel, 100);
+	CHECK(every_count == 3 && timing_wheel_pending(&wheel) == 0);
+	CHECK(!scheduler_cancel(&wheel_scheduler, every_timer) && !scheduler_cancel(&wheel_scheduler, 0));
+	
+	uint64_t now = scheduler_now(&wheel_scheduler);
+	victim_timer = scheduler_schedule_at(&wheel_scheduler, now + 5, &on_victim, NULL);
+	CHECK(scheduler_schedule_at(&wheel_scheduler, now + 5, &on_killer, NULL));
+	timing_wheel_advance(&wheel, 5);
+	CHECK(victim_count == 0);
+	timing_wheel_advance(&wheel, 1);
+	CHECK(victim_count == 1);
+	
+	// beyond the range of the levels
+	static uint64_t far;
+	far = scheduler_now(&wheel_scheduler) + ((uint64_t)1 << 36) + 12345;
+	fired = 0;
+	CHECK(scheduler_schedule_at(&wheel_scheduler, far, &on_due, &far));
+	timing_wheel_advance(&wheel, ((uint64_t)1 << 36) + 12345);
+	CHECK(fired == 1 && late == 0);
+	
+	// advancing from a timer is deferred until it returns
+	static uint64_t nested = 1000;
+	static uint64_t after;
+	now = scheduler_now(&wheel_scheduler);
+	after = now + 2 + 500;
+	fired = 0;
+	CHECK(scheduler_schedule_at(&wheel_scheduler, now + 2, &on_advance, &nested));
+	CHECK(scheduler_schedule_at(&wheel_scheduler, after, &on_due, &after));
+	timing_wheel_advance(&wheel, 2);
+	CHECK(scheduler_now(&wheel_scheduler) == now + 2 + nested);
+	CHECK(fired == 1 && late == 0 && timing_wheel_pending(&wheel) == 0);
+	
+	return TEST_RESULT();
+}